@@ -6,6 +6,8 @@
 
 #include "app.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <xc.h>
 
 // *****************************************************************************
@@ -14,18 +16,9 @@
 // *****************************************************************************
 // *****************************************************************************
 
-#define LSM6DS33 0b1101011
 
-uint8_t APP_MAKE_BUFFER_DMA_READY dataOut[APP_READ_BUFFER_SIZE];
-uint8_t APP_MAKE_BUFFER_DMA_READY readBuffer[APP_READ_BUFFER_SIZE];
-int len, i = 0;
-int rawdata[100], MAFdata[100], FIRdata[100], IIRdata[100]; // declare data arrays
-int ii = 0;
-int sum = 0;       // summation variable for MAF filter
-int j = 0;         // 2nd index variable for FIR filter
-float weights[6] = {0.0264, 0.1405, 0.3331, 0.3331, 0.1405, 0.0264}; // FIR weights
-int dataFlag = 0;
-int startTime = 0; // to remember the loop time
+unsigned int startTime = 0; // to remember the loop time
+bool lcdReady = false; // LCD initialized, and its first screen drawn
 
 // *****************************************************************************
 /* Application Data
@@ -40,6 +33,30 @@ int startTime = 0; // to remember the loop time
 
 APP_DATA appData;
 
+/* USB events for APP_Tasks. The USB handlers run in the USB and Timer2
+ * interrupts and only post here; APP_Tasks takes the events in order */
+#define APP_EVENT_QUEUE_SIZE 8      // a power of 2
+static volatile APP_EVENT eventQueue[APP_EVENT_QUEUE_SIZE];
+static volatile unsigned int eventHead, eventTail;
+
+/* USB interrupt side. The queue only fills if APP_Tasks is stuck, and then
+ * the newest event is dropped */
+static void APP_EventPost(APP_EVENT event) {
+    if (eventHead - eventTail < APP_EVENT_QUEUE_SIZE) {
+        eventQueue[eventHead % APP_EVENT_QUEUE_SIZE] = event;
+        eventHead++;
+    }
+}
+
+bool APP_EventGet(APP_EVENT *event) {
+    if (eventTail == eventHead) {
+        return false;
+    }
+    *event = eventQueue[eventTail % APP_EVENT_QUEUE_SIZE];
+    eventTail++;
+    return true;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Callback Functions
@@ -117,8 +134,9 @@ USB_DEVICE_CDC_EVENT_RESPONSE APP_USBDeviceCDCEventHandler
 
         case USB_DEVICE_CDC_EVENT_READ_COMPLETE:
 
-            /* This means that the host has sent some data*/
-            appDataObject->isReadComplete = true;
+            /* This means that the host has sent some data. cdc_stream
+             * keeps it and queues the next read right away */
+            cdc_stream_event(event, pData);
             break;
 
         case USB_DEVICE_CDC_EVENT_CONTROL_TRANSFER_DATA_RECEIVED:
@@ -137,10 +155,10 @@ USB_DEVICE_CDC_EVENT_RESPONSE APP_USBDeviceCDCEventHandler
 
         case USB_DEVICE_CDC_EVENT_WRITE_COMPLETE:
 
-            /* This means that the data write got completed. We can schedule
-             * the next read. */
+            /* This means that a data write got completed. Its buffer
+             * goes back to the cdc_stream pool */
 
-            appDataObject->isWriteComplete = true;
+            cdc_stream_event(event, pData);
             break;
 
         default:
@@ -168,7 +186,7 @@ void APP_USBDeviceEventHandler(USB_DEVICE_EVENT event, void * eventData, uintptr
 
             /* Update LED to show reset state */
 
-            appData.isConfigured = false;
+            APP_EventPost(APP_EVENT_DECONFIGURED);
 
             break;
 
@@ -185,8 +203,8 @@ void APP_USBDeviceEventHandler(USB_DEVICE_EVENT event, void * eventData, uintptr
 
                 USB_DEVICE_CDC_EventHandlerSet(USB_DEVICE_CDC_INDEX_0, APP_USBDeviceCDCEventHandler, (uintptr_t) & appData);
 
-                /* Mark that the device is now configured */
-                appData.isConfigured = true;
+                /* Let APP_Tasks know the device is now configured */
+                APP_EventPost(APP_EVENT_CONFIGURED);
 
             }
             break;
@@ -201,6 +219,7 @@ void APP_USBDeviceEventHandler(USB_DEVICE_EVENT event, void * eventData, uintptr
 
             /* VBUS is not available any more. Detach the device. */
             USB_DEVICE_Detach(appData.deviceHandle);
+            APP_EventPost(APP_EVENT_DECONFIGURED);
             break;
 
         case USB_DEVICE_EVENT_SUSPENDED:
@@ -234,10 +253,9 @@ bool APP_StateReset(void) {
 
     if (appData.isConfigured == false) {
         appData.state = APP_STATE_WAIT_FOR_CONFIGURATION;
-        appData.readTransferHandle = USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID;
-        appData.writeTransferHandle = USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID;
-        appData.isReadComplete = true;
-        appData.isWriteComplete = true;
+        appData.isStreaming = false;
+        appData.isUploading = false;
+        appData.commandLength = 0;
         retVal = true;
     } else {
         retVal = false;
@@ -246,6 +264,315 @@ bool APP_StateReset(void) {
     return (retVal);
 }
 
+/*****************************************************
+ * Takes one IMU sample, shows it on the LCD and runs
+ * it through the capture engine. While streaming the
+ * rows go out as they come; a capture of a set length
+ * is kept until it is full and then uploaded.
+ *****************************************************/
+
+void APP_Sample(void) {
+    LATAbits.LATA4 = !LATAbits.LATA4; // green LED heartbeat
+    
+    // define data array and LCD string
+    unsigned char imudata[14];
+    char lcd[30];
+    short imu[CAPTURE_CHANNELS], row[CAPTURE_MAX_COLUMNS];
+    int c;
+    
+    // get data and convert to shorts: temperature, gyro x, y, z, accel x, y, z
+    lsm6ds33_read(LSM6DS33_OUT_TEMP_L,imudata,14); // temperature, then gyro and accelerometer
+    for (c = 0; c < CAPTURE_CHANNELS; c++) {
+        imu[c] = (imudata[2 * c + 1] << 8) | imudata[2 * c];
+    }
+    
+    // print data to LCD, about 10 times a second; drawing the lines takes a
+    // few ms, so they are only queued here and APP_Tasks draws them between
+    // samples, and the next ones wait until they are all on the screen
+    if (lcdReady && --appData.lcdCountdown <= 0 && !LCD_textBusy()) {
+        appData.lcdCountdown = appData.sampleHz / 10;
+        sprintf(lcd,"AX = %d   ",imu[4]);
+        LCD_text(10,20,lcd,WHITE,BLACK);
+        sprintf(lcd,"AY = %d   ",imu[5]);
+        LCD_text(10,30,lcd,WHITE,BLACK);
+        sprintf(lcd,"AZ = %d   ",imu[6]);
+        LCD_text(10,40,lcd,WHITE,BLACK);
+    }
+    
+    if (appData.isStreaming && capture_sample(imu, row)) {
+        if (captureConfig.length == 0) {
+            APP_StreamRow(appData.sequence++, row);
+        } else if (capture_done()) {
+            // full, send it
+            appData.isStreaming = false;
+            appData.isUploading = true;
+            appData.uploadRow = 0;
+        }
+    }
+}
+
+/*****************************************************
+ * Accounts for sample periods that went by without a
+ * sample: the rows they would have made are counted
+ * as dropped and, while streaming, skipped in the
+ * sequence numbers, so the host sees the gap.
+ *****************************************************/
+
+void APP_Skip(int samples) {
+    int rows;
+
+    if (!appData.isStreaming) {
+        return;
+    }
+    rows = capture_skip(samples);
+    appData.dropped += rows;
+    if (captureConfig.length == 0) {
+        appData.sequence += rows;
+    }
+}
+
+/*****************************************************
+ * Puts one row in out, as a frame (see
+ * APP_STREAM_SYNC0) or as a text line, and returns
+ * its length, at most APP_STREAM_ROW_MAX.
+ *****************************************************/
+
+int APP_FormatRow(uint8_t *out, uint16_t sequence, const short *row) {
+    int c, n = captureConfig.columns;
+
+    if (appData.isTextOutput) {
+        char *p = (char *) out;
+        p += sprintf(p, "%u", (unsigned) sequence);
+        for (c = 0; c < n; c++) {
+            p += sprintf(p, " %d", row[c]);
+        }
+        p += sprintf(p, "\r\n");
+        return p - (char *) out;
+    }
+    out[0] = APP_STREAM_SYNC0;
+    out[1] = APP_STREAM_SYNC1;
+    out[2] = sequence & 0xFF;
+    out[3] = sequence >> 8;
+    out[4] = n;
+    memcpy(&out[5], row, n * sizeof(short));
+    return 5 + n * sizeof(short);
+}
+
+/*****************************************************
+ * Adds one row to the block being collected and
+ * writes the block once it holds about 10 ms of rows.
+ *****************************************************/
+
+void APP_StreamRow(uint16_t sequence, const short *row) {
+    if (appData.blockLength + APP_STREAM_ROW_MAX > APP_STREAM_BLOCK_SIZE) {
+        APP_StreamFlush();
+    }
+    appData.blockLength += APP_FormatRow(&appData.block[appData.blockLength], sequence, row);
+    if (++appData.blockRows >= appData.blockFrames) {
+        APP_StreamFlush();
+    }
+}
+
+/*****************************************************
+ * Writes the rows collected so far. If the write
+ * pool is full they are dropped and counted, and the
+ * host sees the gap in the sequence numbers.
+ *****************************************************/
+
+void APP_StreamFlush(void) {
+    if (appData.blockLength == 0) {
+        return;
+    }
+    if (cdc_stream_write(appData.block, appData.blockLength) == 0) {
+        appData.dropped += appData.blockRows;
+    }
+    appData.blockLength = 0;
+    appData.blockRows = 0;
+}
+
+/*****************************************************
+ * Sends as much of a finished capture as the write
+ * pool has room for, then "done <rows>". Binary rows
+ * are gathered straight from the capture arena, each
+ * behind its own frame header.
+ *****************************************************/
+
+#define APP_UPLOAD_ROWS 16  // rows per write
+
+void APP_Upload(void) {
+    int rows = capture_rows(), n = captureConfig.columns;
+
+    if (appData.uploadRow < rows) {
+        if (appData.isTextOutput) {
+            // a block of lines at a time, and only when it can be written
+            int len = 0, r = appData.uploadRow;
+            if (cdc_stream_free() > 0) {
+                while (r < rows && len + APP_STREAM_ROW_MAX <= APP_STREAM_BLOCK_SIZE) {
+                    len += APP_FormatRow(&appData.block[len], r, capture_row(r));
+                    r++;
+                }
+                if (cdc_stream_write(appData.block, len) == len) {
+                    appData.uploadRow = r;
+                }
+            }
+        } else {
+            uint8_t header[APP_UPLOAD_ROWS][5];
+            CDC_STREAM_PIECE piece[2 * APP_UPLOAD_ROWS];
+            int k = 0, frame = 5 + n * sizeof(short);
+            while (k < APP_UPLOAD_ROWS && appData.uploadRow + k < rows
+                    && (k + 1) * frame <= cdc_stream_room()) {
+                int r = appData.uploadRow + k;
+                header[k][0] = APP_STREAM_SYNC0;
+                header[k][1] = APP_STREAM_SYNC1;
+                header[k][2] = r & 0xFF;
+                header[k][3] = r >> 8;
+                header[k][4] = n;
+                piece[2 * k].data = header[k];
+                piece[2 * k].len = 5;
+                piece[2 * k + 1].data = capture_row(r);
+                piece[2 * k + 1].len = n * sizeof(short);
+                k++;
+            }
+            if (k > 0 && cdc_stream_writev(piece, 2 * k) == k * frame) {
+                appData.uploadRow += k;
+            }
+        }
+    }
+    if (appData.uploadRow >= rows) {
+        char reply[16];
+        int len = sprintf(reply, "done %d\r\n", rows);
+        if (cdc_stream_write(reply, len) == len) {
+            appData.isUploading = false;
+        }
+    }
+}
+
+/*****************************************************
+ * Carries out one command line from the host:
+ *   start     run the capture: stream every row, or
+ *             with a length, collect and then upload
+ *   stop      stop, answers "stop <rows> <dropped>"
+ *   hz N      sample N times a second (1 to 1000)
+ *   cols ...  the columns, e.g. "cols ax ay az:maf:iir"
+ *             (channels t gx gy gz ax ay az, filters
+ *             maf fir iir applied left to right)
+ *   dec N     keep every N-th row
+ *   len N     rows per capture, 0 streams
+ *   maf N     moving average length (1 to 32)
+ *   iir N     IIR smoothing, 1/2^N of each step
+ *   trig C M L  only capture around the moment
+ *             column C (0 is the first) meets level L,
+ *             M is above, below, rise, fall or mag
+ *             (|value| >= L); "trig off" captures
+ *             straight away. Needs a length.
+ *   pre N     rows kept from before the trigger
+ *   fmt bin   binary frames (see APP_STREAM_SYNC0)
+ *   fmt text  one line of numbers per row
+ *   ?         answers with the settings
+ * A lone 'r' sets up and runs the old 100 sample
+ * accelZ filter capture as text.
+ * The settings only change while nothing runs.
+ *****************************************************/
+
+void APP_Command(const char *line) {
+    char reply[256];
+    int n = 0;
+    bool busy = appData.isStreaming || appData.isUploading;
+
+    if (strcmp(line, "start") == 0) {
+        capture_start();
+        appData.sequence = 0;
+        appData.dropped = 0;
+        appData.blockLength = 0;
+        appData.blockRows = 0;
+        appData.blockFrames = appData.sampleHz / captureConfig.decimation / 100;
+        if (appData.blockFrames < 1) {
+            appData.blockFrames = 1;
+        }
+        appData.isUploading = false;
+        appData.isStreaming = true;
+    } else if (strcmp(line, "stop") == 0) {
+        if (appData.isStreaming) {
+            APP_StreamFlush();
+        }
+        appData.isStreaming = false;
+        appData.isUploading = false;
+        n = sprintf(reply, "stop %u %lu\r\n", (unsigned) appData.sequence, (unsigned long) appData.dropped);
+    } else if (strcmp(line, "?") == 0) {
+        n = sprintf(reply, "hz %d dec %d len %d maf %d iir %d fmt %s run %d seq %u dropped %lu trig ",
+                appData.sampleHz, captureConfig.decimation, captureConfig.length,
+                captureConfig.mafWindow, captureConfig.iirShift, appData.isTextOutput ? "text" : "bin",
+                busy, (unsigned) appData.sequence, (unsigned long) appData.dropped);
+        n += capture_print_trigger(&reply[n], 24);
+        n += sprintf(&reply[n], " pre %d fired %d cols ", captureConfig.pretrigger,
+                appData.isStreaming && captureConfig.length > 0 ? capture_triggered() : 0);
+        n += capture_print_columns(&reply[n], sizeof(reply) - n - 2);
+        n += sprintf(&reply[n], "\r\n");
+    } else if (busy) {
+        n = sprintf(reply, "busy\r\n");
+    } else if (strncmp(line, "hz ", 3) == 0) {
+        int hz = atoi(&line[3]);
+        if (hz >= 1 && hz <= 1000) {
+            appData.sampleHz = hz;
+            appData.samplePeriod = 48000000 / 2 / hz;
+        }
+        n = sprintf(reply, "hz %d\r\n", appData.sampleHz);
+    } else if (strncmp(line, "cols ", 5) == 0) {
+        capture_set_columns(&line[5]);
+        if (captureConfig.length > capture_max_length()) {
+            captureConfig.length = capture_max_length();
+        }
+        n = sprintf(reply, "cols ");
+        n += capture_print_columns(&reply[n], sizeof(reply) - n - 2);
+        n += sprintf(&reply[n], "\r\n");
+    } else if (strncmp(line, "dec ", 4) == 0) {
+        int d = atoi(&line[4]);
+        if (d >= 1 && d <= 1000) {
+            captureConfig.decimation = d;
+        }
+        n = sprintf(reply, "dec %d\r\n", captureConfig.decimation);
+    } else if (strncmp(line, "len ", 4) == 0) {
+        int l = atoi(&line[4]);
+        if (l >= 0) {
+            captureConfig.length = l < capture_max_length() ? l : capture_max_length();
+        }
+        n = sprintf(reply, "len %d\r\n", captureConfig.length);
+    } else if (strncmp(line, "maf ", 4) == 0) {
+        int w = atoi(&line[4]);
+        if (w >= 1 && w <= CAPTURE_MAF_MAX) {
+            captureConfig.mafWindow = w;
+        }
+        n = sprintf(reply, "maf %d\r\n", captureConfig.mafWindow);
+    } else if (strncmp(line, "iir ", 4) == 0) {
+        int s = atoi(&line[4]);
+        if (s >= 0 && s <= 15) {
+            captureConfig.iirShift = s;
+        }
+        n = sprintf(reply, "iir %d\r\n", captureConfig.iirShift);
+    } else if (strncmp(line, "trig ", 5) == 0) {
+        capture_set_trigger(&line[5]);
+        n = sprintf(reply, "trig ");
+        n += capture_print_trigger(&reply[n], 24);
+        n += sprintf(&reply[n], "\r\n");
+    } else if (strncmp(line, "pre ", 4) == 0) {
+        int p = atoi(&line[4]);
+        if (p >= 0) {
+            captureConfig.pretrigger = p;
+        }
+        n = sprintf(reply, "pre %d\r\n", captureConfig.pretrigger);
+    } else if (strncmp(line, "fmt ", 4) == 0) {
+        if (strcmp(&line[4], "text") == 0) {
+            appData.isTextOutput = true;
+        } else if (strcmp(&line[4], "bin") == 0) {
+            appData.isTextOutput = false;
+        }
+        n = sprintf(reply, "fmt %s\r\n", appData.isTextOutput ? "text" : "bin");
+    }
+    if (n > 0) {
+        cdc_stream_write(reply, n);
+    }
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Initialization and State Machine Functions
@@ -275,53 +602,41 @@ void APP_Initialize(void) {
     appData.getLineCodingData.bParityType = 0;
     appData.getLineCodingData.bDataBits = 8;
 
-    /* Read Transfer Handle */
-    appData.readTransferHandle = USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID;
-
-    /* Write Transfer Handle */
-    appData.writeTransferHandle = USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID;
-
-    /* Intialize the read complete flag */
-    appData.isReadComplete = true;
-
-    /*Initialize the write complete flag*/
-    appData.isWriteComplete = true;
+    /* Sample at 400 Hz, all channels unfiltered, not running */
+    appData.sampleHz = 400;
+    appData.samplePeriod = 48000000 / 2 / 400;
+    appData.lcdCountdown = 0;
+    appData.isStreaming = false;
+    appData.isUploading = false;
+    appData.isTextOutput = false;
+    appData.commandLength = 0;
+    appData.blockLength = 0;
+    appData.blockRows = 0;
+    capture_setup();
+
+    /* No CDC transfers in flight, no USB events */
+    cdc_stream_setup();
+    eventHead = eventTail = 0;
 
     /* Reset other flags */
     appData.sofEventHasOccurred = false;
     //appData.isSwitchPressed = false;
 
-    /* Set up the read buffer */
-    appData.readBuffer = &readBuffer[0];
-
     /* PUT YOUR LCD, IMU, AND PIN INITIALIZATIONS HERE */
     //initializations
     BMXCONbits.BMXWSDRM = 0x0;                                   // 0 data RAM access wait states
     INTCONbits.MVEC = 0x1;                                       // enable multi vector interrupts
     DDPCONbits.JTAGEN = 0;                                       // disable JTAG to get pins back
     i2c_master_setup();                                          // set up I2C2 as master, at 400 kHz
-    IMU_init();                                                  // initialize LSM6DS33
-    LCD_init();                                                  // initialize LCD/SPI communication
+    lsm6ds33_setup();                                            // initialize LSM6DS33:
+    lsm6ds33_accel(LSM6DS33_ODR_1660HZ, LSM6DS33_XL_2G, LSM6DS33_XL_BW_100HZ); // 1.66 kHz, 2 g, 100 Hz LPF
+    lsm6ds33_gyro(LSM6DS33_ODR_1660HZ, LSM6DS33_G_1000DPS);     // 1.66 kHz, 1000 dps
+    lsm6ds33_flush();                                            // all registers, in burst writes
+    LCD_init_start();                                            // initialize LCD/SPI communication, the
+                                                                 // rest is sent from APP_Tasks
     TRISAbits.TRISA4 = 0;                                        // set up green LED heartbeat check
     LATAbits.LATA4 = 0;   
     
-    // setup LCD
-    LCD_clearScreen(BLACK);
-    
-    //IMU WHOAMI check
-    char lcd[30];
-    i2c_master_start();
-    i2c_master_send((LSM6DS33 << 1) | 0); // notify via write
-    i2c_master_send(0x0F); // WHOAMI register
-    i2c_master_restart();
-    i2c_master_send((LSM6DS33 << 1) | 1); // master is reading
-    int whoami = (int) i2c_master_recv();
-    i2c_master_ack(1);
-    i2c_master_stop();
-    sprintf(lcd,"WHOAMI = %d",whoami);
-    drawString(10,10,lcd,WHITE,BLACK);
-    
-    
     /* STARTTIME*/
     startTime = _CP0_GET_COUNT();
 }
@@ -334,6 +649,40 @@ void APP_Initialize(void) {
  */
 
 void APP_Tasks(void) {
+    APP_EVENT event;
+
+    // the LCD boots (a few hundred ms of waits) alongside USB and the IMU
+    // rather than before them, and is only drawn on once it's done
+    if (!lcdReady && LCD_init_task()) {
+        char lcd[30];
+        LCD_clearScreen(BLACK);
+        sprintf(lcd,"WHOAMI = %d",lsm6ds33_who_am_i());  // IMU WHOAMI check
+        drawString(10,10,lcd,WHITE,BLACK);
+        lcdReady = true;
+    }
+
+    /* Take the USB events posted since the last pass. The configured
+     * state only changes here, so cdc_stream is started and stopped by
+     * one side only */
+    while (APP_EventGet(&event)) {
+        switch (event) {
+            case APP_EVENT_CONFIGURED:
+                /* Start receiving, and empty the write pool */
+                cdc_stream_start();
+                appData.isConfigured = true;
+                break;
+
+            case APP_EVENT_DECONFIGURED:
+                /* The transfers in flight were cancelled by the reset */
+                cdc_stream_stop();
+                appData.isConfigured = false;
+                break;
+
+            default:
+                break;
+        }
+    }
+
     /* Update the application state machine based
      * on the current state */
 
@@ -359,168 +708,71 @@ void APP_Tasks(void) {
 
             /* Check if the device was configured */
             if (appData.isConfigured) {
-                /* If the device is configured then lets start reading */
-                appData.state = APP_STATE_SCHEDULE_READ;
+                /* cdc_stream is already reading, start sampling */
+                appData.state = APP_STATE_CHECK_TIMER;
             }
             break;
 
-        case APP_STATE_SCHEDULE_READ:
+        case APP_STATE_CHECK_TIMER:
 
             if (APP_StateReset()) {
                 break;
             }
 
-            /* If a read is complete, then schedule a read
-             * else wait for the current read to complete */
-
-            appData.state = APP_STATE_WAIT_FOR_READ_COMPLETE;
-            if (appData.isReadComplete == true) {
-                appData.isReadComplete = false;
-                appData.readTransferHandle = USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID;
-
-                USB_DEVICE_CDC_Read(USB_DEVICE_CDC_INDEX_0,
-                        &appData.readTransferHandle, appData.readBuffer,
-                        APP_READ_BUFFER_SIZE);
-
-                        /* AT THIS POINT, appData.readBuffer[0] CONTAINS A LETTER
-                        THAT WAS SENT FROM THE COMPUTER */
-                        /* YOU COULD PUT AN IF STATEMENT HERE TO DETERMINE WHICH LETTER
-                        WAS RECEIVED (USUALLY IT IS THE NULL CHARACTER BECAUSE NOTHING WAS
-                      TYPED) */
-                if(appData.readBuffer[0] == 'r') {
-                    sum = 0;                        // reset MAF sum
-                    for (ii = 0; ii < 100; ii++) {  // set arrays to 0
-                        rawdata[ii] = 0;
-                        MAFdata[ii] = 0;
-                        FIRdata[ii] = 0;
-                        IIRdata[ii] = 0;
+            /* Reads and writes run on their own in cdc_stream, so this
+             * state only looks at what the host sent and samples */
+            {
+                char cmd[16];
+                int n = cdc_stream_read(cmd, sizeof(cmd));
+                int k;
+                for (k = 0; k < n; k++) {
+                    if (cmd[k] == '\r' || cmd[k] == '\n') {
+                        /* end of a command line */
+                        appData.command[appData.commandLength] = 0;
+                        if (appData.commandLength > 0) {
+                            APP_Command(appData.command);
+                        }
+                        appData.commandLength = 0;
+                    } else if (cmd[k] == 'r' && appData.commandLength == 0) {
+                        /* 'r' typed in a terminal, no enter needed: the
+                         * old 100 sample accelZ filter capture, as text */
+                        if (!appData.isStreaming && !appData.isUploading) {
+                            capture_set_columns("az az:maf az:fir az:iir");
+                            captureConfig.decimation = 1;
+                            captureConfig.length = 100;
+                            captureConfig.trigger = CAPTURE_TRIG_OFF;
+                            appData.isTextOutput = true;
+                            APP_Command("start");
+                        }
+                    } else if (appData.commandLength < (int) sizeof(appData.command) - 1) {
+                        appData.command[appData.commandLength++] = cmd[k];
                     }
-                    dataFlag = 1;  // send data (after it's collected)
-                }
-
-                if (appData.readTransferHandle == USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID) {
-                    appData.state = APP_STATE_ERROR;
-                    break;
                 }
             }
 
-            break;
-
-        case APP_STATE_WAIT_FOR_READ_COMPLETE:
-        case APP_STATE_CHECK_TIMER:
-
-            if (APP_StateReset()) {
-                break;
-            }
-
-            /* Check if a character was received or a switch was pressed.
-             * The isReadComplete flag gets updated in the CDC event handler. */
-
-             /* WAIT FOR 100 HZ TO PASS */
-            if (appData.isReadComplete || _CP0_GET_COUNT() - startTime > (48000000 / 2 / 400)) {
-                appData.state = APP_STATE_SCHEDULE_WRITE;
+            /* Send a finished capture as the write pool frees up */
+            if (appData.isUploading) {
+                APP_Upload();
             }
 
-
-            break;
-
-
-        case APP_STATE_SCHEDULE_WRITE:
-
-            if (APP_StateReset()) {
-                break;
+            /* Draw the queued LCD text a character (about 90 us) at a
+             * time, and only in the first half of a sample period, so
+             * it never holds up a sample */
+            if (lcdReady && _CP0_GET_COUNT() - startTime < appData.samplePeriod / 2) {
+                LCD_textTask(1);
             }
 
-            /* Setup the write */
-
-            appData.writeTransferHandle = USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID;
-            appData.isWriteComplete = false;
-            appData.state = APP_STATE_WAIT_FOR_WRITE_COMPLETE;
-
-            /* PUT THE TEXT YOU WANT TO SEND TO THE COMPUTER IN dataOut
-            AND REMEMBER THE NUMBER OF CHARACTERS IN len */
-            /* THIS IS WHERE YOU CAN READ YOUR IMU, PRINT TO THE LCD, ETC */
-            
-            LATAbits.LATA4 = !LATAbits.LATA4; // green LED heartbeat
-            
-            // define data array and LCD string
-            unsigned char imudata[14];
-            char lcd[30];
-            
-            // get data and convert to shorts
-            i2c_read_multiple(LSM6DS33,0x20,imudata,14); // 0x20 = temp_L register
-            signed short temperature = (imudata[1] << 8) | imudata[0];   
-            signed short gyroX = (imudata[3] << 8) | imudata[2];   
-            signed short gyroY = (imudata[5] << 8) | imudata[4];   
-            signed short gyroZ = (imudata[7] << 8) | imudata[6];   
-            signed short accelX = (imudata[9] << 8) | imudata[8];   
-            signed short accelY = (imudata[11] << 8) | imudata[10]; 
-            signed short accelZ = (imudata[13] << 8) | imudata[12]; 
-            
-            // print data to LCD
-            sprintf(lcd,"AX = %d   ",accelX);
-            drawString(10,20,lcd,WHITE,BLACK);
-            sprintf(lcd,"AY = %d   ",accelY);
-            drawString(10,30,lcd,WHITE,BLACK);
-            sprintf(lcd,"AZ = %d   ",accelZ);
-            drawString(10,40,lcd,WHITE,BLACK);
-            
-            
-            /* Filter accelZ data */
-            rawdata[i] = accelZ;
-            
-            // MAF: filtered data = summation(all data)/(# points)
-            sum += rawdata[i];
-            MAFdata[i] = sum/(i+1);
-            
-            // FIR: filtered data = summation(weights*data points)
-            for (j = 0; j < 6; j++) {
-                FIRdata[i] += weights[j]*rawdata[i-j]; 
-                if (i-j < 0) {
-                    rawdata[i-j] = 0;   // for the first 6 points, some of the [i-j] points will be 0
-                }
-            }
-            
-            // IIR: 2 weights - 1 for new data, 1 for old data
-            if (i == 0) {rawdata[i-1] = 0;}  // so that the computer isn't confused by [-1]
-            IIRdata[i] = 0.5*rawdata[i-1] + 0.5*rawdata[i];
-            if (i == 100) {rawdata[i] = IIRdata[i];}
-            
-            
-            /* Send Data to computer (only if 'r' is received, i.e. flag = 1) */
-            if (dataFlag == 1) {
-                len = sprintf(dataOut, "%d %d %d %d %d\r\n", i, accelZ, MAFdata[i], FIRdata[i], IIRdata[i]);
-                i++;             // increment the index 
-                if (i == 100) {  // after 100 data points, stop sending data
-                    i = 0;
-                    dataFlag = 0;
+             /* WAIT FOR THE SAMPLE PERIOD TO PASS */
+            if (_CP0_GET_COUNT() - startTime >= appData.samplePeriod) {
+                /* Advance by whole periods so the rate is exact; periods
+                 * missed altogether are skipped, and counted */
+                uint32_t missed = (_CP0_GET_COUNT() - startTime) / appData.samplePeriod - 1;
+                startTime += (missed + 1) * appData.samplePeriod;
+                if (missed > 0) {
+                    APP_Skip((int) missed);
                 }
-            } else {
-                len = 1;
-                dataOut[0] = 0;
+                APP_Sample();
             }
-            USB_DEVICE_CDC_Write(USB_DEVICE_CDC_INDEX_0,
-                        &appData.writeTransferHandle, dataOut, len,
-                        USB_DEVICE_CDC_TRANSFER_FLAGS_DATA_COMPLETE);
-            
-            
-            /* Reset Timer for accurate delays */
-            startTime = _CP0_GET_COUNT(); 
-            break;
-
-        case APP_STATE_WAIT_FOR_WRITE_COMPLETE:
-
-            if (APP_StateReset()) {
-                break;
-            }
-
-            /* Check if a character was sent. The isWriteComplete
-             * flag gets updated in the CDC event handler */
-
-            if (appData.isWriteComplete == true) {
-                appData.state = APP_STATE_SCHEDULE_READ;
-            }
-
             break;
 
         case APP_STATE_ERROR:
@@ -530,47 +782,6 @@ void APP_Tasks(void) {
     }
 }
 
-void IMU_init() {
-    // accelerometer init: 1.66 kHz sample rate, 2g sensitivity, 100 Hz anti-aliasing LPF
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x10); // CTRL1_XL register 
-    i2c_master_send(0b10000010);
-    i2c_master_stop();
-    
-    // gyroscope init: 1.66 kHz sample rate, 1000 dps sensitivity
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x11); // CTRL2_G register 
-    i2c_master_send(0b10001000);
-    i2c_master_stop();
-    
-    // CTRL3_C: make IF_INC = 1 to read multiple registers in a row w/o specifying every address
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x12); // CTRL3_C register 
-    i2c_master_send(0b00000100);
-    i2c_master_stop();
-}
-
-void i2c_read_multiple(unsigned char address, unsigned char reg, unsigned char *data, int length) {
-    // set register to read from 
-    i2c_master_start();
-    i2c_master_send((address << 1) | 0); // notify via write
-    i2c_master_send(reg); // 
-    i2c_master_restart();
-    
-    // loop to get all data
-    int i = 0;
-    i2c_master_send((address << 1) | 1); // master is reading
-    for (i = 0; i <= length-1; i++) {
-        data[i] = i2c_master_recv();
-        if (i < length-1) {
-            i2c_master_ack(0);      // not done getting all the data
-        } else {i2c_master_ack(1);} // done getting all data    
-    }
-    i2c_master_stop();
-}
 
 /*******************************************************************************
  End of File
@@ -15,6 +15,9 @@
 #include "system_definitions.h"
 #include "ST7735.h"
 #include "i2c_master_noint.h"
+#include "lsm6ds33.h"
+#include "cdc_stream.h"
+#include "capture.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -47,25 +50,53 @@ typedef enum
 	/* Application waits for device configuration*/
     APP_STATE_WAIT_FOR_CONFIGURATION,
 
-    /* The application checks if a switch was pressed */
+    /* The application takes commands and samples the IMU at 400 Hz */
     APP_STATE_CHECK_TIMER,
 
-    /* Wait for a character receive */
-    APP_STATE_SCHEDULE_READ,
+    /* Application Error state*/
+    APP_STATE_ERROR
 
-    /* A character is received from host */
-    APP_STATE_WAIT_FOR_READ_COMPLETE,
+} APP_STATES;
 
-    /* Wait for the TX to get completed */
-    APP_STATE_SCHEDULE_WRITE,
 
-    /* Wait for the write to complete */
-    APP_STATE_WAIT_FOR_WRITE_COMPLETE,
+// *****************************************************************************
+/* Stream Frames
+  Summary:
+    Layout of the capture rows sent in binary ("fmt bin")
+  Description:
+    Each row is a frame: 0xA5 0x5A, a 16 bit sequence number, the number of
+    columns n, then n 16 bit values (see capture.h), all little endian.
+    While streaming, a gap in the sequence numbers is rows that found no
+    room in the write pool, or whose samples were never taken because the
+    sample period was missed altogether. An uploaded capture is numbered by row, oldest
+    first, and ends with a "done <rows>" line; with a trigger the trigger
+    row is numbered pretrigger ("pre" in the "?" reply).
+*/
 
-    /* Application Error state*/
-    APP_STATE_ERROR
+#define APP_STREAM_SYNC0 0xA5
+#define APP_STREAM_SYNC1 0x5A
+#define APP_STREAM_ROW_MAX (8 + CAPTURE_MAX_COLUMNS * 7)   // longest row, frame or text
+#define APP_STREAM_BLOCK_SIZE 512                          // rows written together, at most
 
-} APP_STATES;
+
+// *****************************************************************************
+/* Application Events
+  Summary:
+    USB events passed from the USB interrupts to APP_Tasks
+  Description:
+    The USB device layer handlers run in interrupt context. They post these
+    events and APP_Tasks acts on them, in order, from the main loop.
+*/
+
+typedef enum
+{
+    /* The host selected configuration 1 */
+    APP_EVENT_CONFIGURED,
+
+    /* A bus reset or VBUS loss ended the configuration */
+    APP_EVENT_DECONFIGURED
+
+} APP_EVENT;
 
 
 // *****************************************************************************
@@ -98,26 +129,41 @@ typedef struct
     /* Control Line State */
     USB_CDC_CONTROL_LINE_STATE controlLineStateData;
 
-    /* Read transfer handle */
-    USB_DEVICE_CDC_TRANSFER_HANDLE readTransferHandle;
-
-    /* Write transfer handle */
-    USB_DEVICE_CDC_TRANSFER_HANDLE writeTransferHandle;
-
-    /* True if a character was read */
-    bool isReadComplete;
-
-    /* True if a character was written*/
-    bool isWriteComplete;
-
     /* Flag determines SOF event occurrence */
     bool sofEventHasOccurred;
 
     /* Break data */
     uint16_t breakData;
 
-    /* Application CDC read buffer */
-    uint8_t * readBuffer;
+    /* Command line being received from the host */
+    char command[32];
+    int commandLength;
+
+    /* Samples per second ("hz N"), as core timer ticks between samples */
+    int sampleHz;
+    uint32_t samplePeriod;
+
+    /* Samples until the LCD is next updated */
+    int lcdCountdown;
+
+    /* Running a capture, the sequence number of the next streamed row
+     * and the rows that found no room in the write pool or were missed */
+    bool isStreaming;
+    uint16_t sequence;
+    uint32_t dropped;
+
+    /* Sending a finished capture, from this row on */
+    bool isUploading;
+    int uploadRow;
+
+    /* Rows as text lines instead of frames */
+    bool isTextOutput;
+
+    /* Rows waiting to be written together, about 10 ms worth */
+    uint8_t block[APP_STREAM_BLOCK_SIZE];
+    int blockLength;
+    int blockRows;
+    int blockFrames;
 
 } APP_DATA;
 
@@ -188,9 +234,14 @@ void APP_Initialize ( void );
 
 void APP_Tasks( void );
 
-void IMU_init(void);
-void i2c_read_multiple(unsigned char, unsigned char, unsigned char *, int);
-
+bool APP_EventGet(APP_EVENT *event);   // next USB event, false if there is none
+void APP_Command(const char *line);
+void APP_Sample(void);
+void APP_Skip(int samples);
+int APP_FormatRow(uint8_t *out, uint16_t sequence, const short *row);
+void APP_StreamRow(uint16_t sequence, const short *row);
+void APP_StreamFlush(void);
+void APP_Upload(void);
 #endif /* _APP_H */
 
 //DOM-IGNORE-BEGIN
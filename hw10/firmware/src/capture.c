@@ -0,0 +1,322 @@
+#include "capture.h"
+#include <stdio.h>
+#include <string.h>
+
+// Capture engine
+// Every IMU sample goes through each column's filter chain, so the filters
+// run at the full sample rate whatever the decimation. Each stage of each
+// column keeps its own history, so "az:maf:fir" smooths the moving average.
+// All in integers: the FIR taps are the old float weights in Q15 and the
+// IIR keeps 8 fraction bits.
+// A fixed-length capture stores its rows back to back in one static arena;
+// fewer columns leave room for longer captures.
+// With a trigger the arena is a ring: rows go in at head until the trigger
+// has fired and the rows after it fill what pretrigger leaves, then the
+// ring freezes with the oldest row at head. The trigger is checked on every
+// filtered sample, so a spike between decimated rows still fires it; the
+// next row kept is the trigger row. It is only armed once the ring holds
+// pretrigger rows, so the trigger row always lands at row pretrigger.
+
+#define FIR_TAPS 6
+#define HIST (CAPTURE_MAF_MAX + 1)  // the newest sample and a full window before it
+
+static const short firWeight[FIR_TAPS] = {865, 4604, 10915, 10915, 4604, 865}; // sum 32768
+static const char *channelName[CAPTURE_CHANNELS] = {"t", "gx", "gy", "gz", "ax", "ay", "az"};
+static const char *stageName[] = {"", "maf", "fir", "iir"};
+static const char *triggerName[] = {"off", "above", "below", "rise", "fall", "mag"};
+
+typedef struct {
+    short hist[HIST];               // last inputs, newest at pos
+    int pos;
+    int count;                      // inputs so far, up to HIST
+    long acc;                       // MAF: sum of the window, IIR: output << 8
+} stage_t;
+
+CAPTURE_CONFIG captureConfig;
+
+static stage_t stage[CAPTURE_MAX_COLUMNS][CAPTURE_MAX_STAGES];
+static short arena[CAPTURE_ARENA_WORDS];
+static int rows;                    // rows stored
+static int head;                    // arena row the next row goes in
+static int skip;                    // samples until the next row is kept
+static int fired;                   // the trigger has fired
+static int left;                    // rows still to store after the trigger, -1 before it
+static int pre;                     // rows to keep from before the trigger
+static int samples;                 // samples since the start, up to 2
+static long previous;               // last value of the trigger column
+
+void capture_setup(void) {
+    captureConfig.columns = 0;
+    capture_set_columns("t gx gy gz ax ay az");
+    captureConfig.decimation = 1;
+    captureConfig.length = 0;
+    captureConfig.mafWindow = 8;
+    captureConfig.iirShift = 1;
+    captureConfig.trigger = CAPTURE_TRIG_OFF;
+    captureConfig.triggerColumn = 0;
+    captureConfig.triggerLevel = 0;
+    captureConfig.pretrigger = 0;
+    capture_start();
+}
+
+// index of the name (len characters at s) in names, -1 if it isn't there
+static int find(const char *s, int len, const char **names, int n) {
+    int k;
+    for (k = 0; k < n; k++) {
+        if ((int) strlen(names[k]) == len && strncmp(s, names[k], len) == 0) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+int capture_set_columns(const char *spec) {
+    CAPTURE_COLUMN col[CAPTURE_MAX_COLUMNS];
+    const char *p = spec;
+    int n = 0;
+
+    memset(col, 0, sizeof(col));
+    while (*p) {
+        int s = -1;             // -1 while reading the channel name
+        if (*p == ' ') {
+            p++;
+            continue;
+        }
+        if (n == CAPTURE_MAX_COLUMNS) {
+            return 0;
+        }
+        // a word: channel[:filter[:filter...]]
+        while (*p && *p != ' ') {
+            int len = strcspn(p, ": ");
+            if (s < 0) {
+                int ch = find(p, len, channelName, CAPTURE_CHANNELS);
+                if (ch < 0) {
+                    return 0;
+                }
+                col[n].channel = ch;
+            } else {
+                int f = find(p, len, stageName, 4);
+                if (f <= 0 || s == CAPTURE_MAX_STAGES) {
+                    return 0;
+                }
+                col[n].stage[s] = f;
+            }
+            s++;
+            p += len;
+            if (*p == ':') {
+                p++;
+            }
+        }
+        n++;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    memcpy(captureConfig.column, col, sizeof(col));
+    captureConfig.columns = n;
+    if (captureConfig.triggerColumn >= n) {
+        captureConfig.trigger = CAPTURE_TRIG_OFF;
+        captureConfig.triggerColumn = 0;
+    }
+    return n;
+}
+
+int capture_print_columns(char *out, int max) {
+    int len = 0, c, s;
+    out[0] = 0;
+    for (c = 0; c < captureConfig.columns && len < max; c++) {
+        len += snprintf(out + len, max - len, c ? " %s" : "%s",
+                channelName[captureConfig.column[c].channel]);
+        for (s = 0; s < CAPTURE_MAX_STAGES && captureConfig.column[c].stage[s] && len < max; s++) {
+            len += snprintf(out + len, max - len, ":%s", stageName[captureConfig.column[c].stage[s]]);
+        }
+    }
+    return len < max ? len : max - 1;
+}
+
+int capture_max_length(void) {
+    return CAPTURE_ARENA_WORDS / captureConfig.columns;
+}
+
+int capture_set_trigger(const char *spec) {
+    char name[8];
+    int column, level, t;
+
+    if (strcmp(spec, "off") == 0) {
+        captureConfig.trigger = CAPTURE_TRIG_OFF;
+        return 1;
+    }
+    // column mode level
+    if (sscanf(spec, "%d %7s %d", &column, name, &level) != 3
+            || column < 0 || column >= captureConfig.columns) {
+        return 0;
+    }
+    t = find(name, strlen(name), triggerName, 6);
+    if (t <= 0) {
+        return 0;
+    }
+    captureConfig.trigger = t;
+    captureConfig.triggerColumn = column;
+    captureConfig.triggerLevel = level;
+    return 1;
+}
+
+int capture_print_trigger(char *out, int max) {
+    int len;
+    if (captureConfig.trigger == CAPTURE_TRIG_OFF) {
+        len = snprintf(out, max, "off");
+    } else {
+        len = snprintf(out, max, "%d %s %d", captureConfig.triggerColumn,
+                triggerName[captureConfig.trigger], captureConfig.triggerLevel);
+    }
+    return len < max ? len : max - 1;
+}
+
+void capture_start(void) {
+    memset(stage, 0, sizeof(stage));
+    rows = 0;
+    head = 0;
+    skip = 0;
+    fired = captureConfig.trigger == CAPTURE_TRIG_OFF;
+    left = -1;
+    samples = 0;
+    if (captureConfig.pretrigger >= captureConfig.length) {
+        captureConfig.pretrigger = captureConfig.length > 0 ? captureConfig.length - 1 : 0;
+    }
+    pre = fired ? 0 : captureConfig.pretrigger;
+}
+
+// does v (after previous) fire the trigger
+static int check(long v) {
+    long level = captureConfig.triggerLevel;
+    switch (captureConfig.trigger) {
+        case CAPTURE_TRIG_ABOVE:
+            return v >= level;
+        case CAPTURE_TRIG_BELOW:
+            return v <= level;
+        case CAPTURE_TRIG_RISE:
+            return previous < level && v >= level;
+        case CAPTURE_TRIG_FALL:
+            return previous > level && v <= level;
+        case CAPTURE_TRIG_MAG:
+            return v >= level || -v >= level;
+    }
+    return 0;
+}
+
+static long filter(stage_t *st, int type, long x) {
+    long y = x;
+    int k;
+
+    st->pos = (st->pos + 1) % HIST;
+    st->hist[st->pos] = (short) x;
+    if (st->count < HIST) {
+        st->count++;
+    }
+
+    switch (type) {
+        case CAPTURE_MAF: {
+            // the sample leaving the window is mafWindow back; until the window
+            // has filled, average what there is
+            int w = captureConfig.mafWindow;
+            st->acc += x;
+            if (st->count > w) {
+                st->acc -= st->hist[(st->pos + HIST - w) % HIST];
+            }
+            y = st->acc / (st->count < w ? st->count : w);
+            break;
+        }
+        case CAPTURE_FIR:
+            // samples before the first count as 0
+            y = 0;
+            for (k = 0; k < FIR_TAPS && k < st->count; k++) {
+                y += (long) firWeight[k] * st->hist[(st->pos + HIST - k) % HIST];
+            }
+            y >>= 15;
+            break;
+        case CAPTURE_IIR:
+            if (st->count == 1) {
+                st->acc = x * 256;      // start at the first sample, not at 0
+            }
+            st->acc += (x * 256 - st->acc) >> captureConfig.iirShift;
+            y = st->acc >> 8;
+            break;
+    }
+    return y;
+}
+
+int capture_sample(const short *imu, short *row) {
+    int c, s;
+
+    for (c = 0; c < captureConfig.columns; c++) {
+        const CAPTURE_COLUMN *col = &captureConfig.column[c];
+        long v = imu[col->channel];
+        for (s = 0; s < CAPTURE_MAX_STAGES && col->stage[s]; s++) {
+            v = filter(&stage[c][s], col->stage[s], v);
+        }
+        row[c] = (short) v;
+    }
+
+    if (!fired && captureConfig.length > 0) {
+        long v = row[captureConfig.triggerColumn];
+        // the first sample has nothing before it to make an edge
+        if (samples < 2) {
+            samples++;
+        }
+        if (rows >= pre && samples > 1 && check(v)) {
+            fired = 1;
+        }
+        previous = v;
+    }
+
+    if (skip > 0) {
+        skip--;
+        return 0;
+    }
+    skip = captureConfig.decimation - 1;
+    if (captureConfig.length > 0 && !capture_done()) {
+        memcpy(&arena[head * captureConfig.columns], row, captureConfig.columns * sizeof(short));
+        head = (head + 1) % captureConfig.length;
+        if (rows < captureConfig.length) {
+            rows++;
+        }
+        if (left > 0) {
+            left--;
+        } else if (left < 0 && fired) {
+            // this is the trigger row (or the last row with no trigger)
+            left = captureConfig.length - pre - 1;
+        }
+    }
+    return 1;
+}
+
+int capture_skip(int samples) {
+    int rows;
+
+    if (samples <= skip) {
+        skip -= samples;
+        return 0;
+    }
+    // the first of them at skip, then one every decimation samples
+    rows = (samples - skip - 1) / captureConfig.decimation + 1;
+    skip = captureConfig.decimation - 1 - (samples - skip - 1) % captureConfig.decimation;
+    return rows;
+}
+
+int capture_triggered(void) {
+    return fired;
+}
+
+int capture_done(void) {
+    return rows == captureConfig.length && left == 0;
+}
+
+int capture_rows(void) {
+    return rows;
+}
+
+const short *capture_row(int n) {
+    // once the ring has wrapped the oldest row is the one head overwrites next
+    int first = rows < captureConfig.length ? 0 : head;
+    return &arena[((first + n) % captureConfig.length) * captureConfig.columns];
+}
@@ -0,0 +1,65 @@
+#ifndef CAPTURE_H__
+#define CAPTURE_H__
+// Header file for capture.c
+// turns IMU samples into rows of columns: each column is one of the 7 IMU
+// channels run through a chain of filters, rows are decimated, and a
+// fixed-length capture is kept in a static arena until it's uploaded; with a
+// trigger the arena is a ring that keeps the rows before the trigger too
+
+#define CAPTURE_CHANNELS 7          // temperature, gyro x, y, z, accelerometer x, y, z
+#define CAPTURE_MAX_COLUMNS 8
+#define CAPTURE_MAX_STAGES 3        // filters per column
+#define CAPTURE_ARENA_WORDS 4096    // rows * columns that a capture can hold
+#define CAPTURE_MAF_MAX 32          // longest moving average
+
+// filter stages
+#define CAPTURE_MAF 1               // moving average of the last mafWindow samples
+#define CAPTURE_FIR 2               // 6 tap low pass
+#define CAPTURE_IIR 3               // first order low pass, y += (x - y) / 2^iirShift
+
+// triggers, on the value v of one column
+#define CAPTURE_TRIG_OFF 0          // capture straight away
+#define CAPTURE_TRIG_ABOVE 1        // v >= level
+#define CAPTURE_TRIG_BELOW 2        // v <= level
+#define CAPTURE_TRIG_RISE 3         // v goes from below level to level or above
+#define CAPTURE_TRIG_FALL 4         // v goes from above level to level or below
+#define CAPTURE_TRIG_MAG 5          // |v| >= level
+
+typedef struct {
+    unsigned char channel;                      // 0 to CAPTURE_CHANNELS - 1
+    unsigned char stage[CAPTURE_MAX_STAGES];    // applied in order, 0 ends the chain
+} CAPTURE_COLUMN;
+
+typedef struct {
+    int columns;
+    CAPTURE_COLUMN column[CAPTURE_MAX_COLUMNS];
+    int decimation;     // keep every n-th row, the filters still see every sample
+    int length;         // rows per capture, 0 streams without storing
+    int mafWindow;      // 1 to CAPTURE_MAF_MAX
+    int iirShift;       // 0 to 15
+    int trigger;        // CAPTURE_TRIG_..., only with a length
+    int triggerColumn;  // the column it watches, every sample, decimated or not
+    int triggerLevel;
+    int pretrigger;     // rows kept from before the trigger, less than length
+} CAPTURE_CONFIG;
+
+extern CAPTURE_CONFIG captureConfig;   // only change between captures
+
+void capture_setup(void);              // all 7 channels unfiltered, streaming
+int capture_set_columns(const char *spec); // e.g. "az az:maf az:fir:iir", returns 0 if invalid
+int capture_print_columns(char *out, int max); // the spec back, returns its length
+int capture_max_length(void);          // longest capture the arena holds with these columns
+void capture_start(void);              // clear the filters and the arena
+int capture_sample(const short *imu, short *row); // filter one sample, returns 1 if it makes
+                                                  // a row (also stored while capturing a length)
+int capture_skip(int samples);         // samples that were never taken: keeps the decimation
+                                       // in step, returns the rows they would have made
+int capture_triggered(void);           // 1 once the trigger has fired (or if there is none)
+int capture_done(void);                // 1 once a capture of a length is complete
+int capture_rows(void);                // rows stored
+const short *capture_row(int n);       // stored row n, oldest first; with a trigger the
+                                       // trigger row is row pretrigger
+int capture_set_trigger(const char *spec); // e.g. "1 rise 2000" or "off", returns 0 if invalid
+int capture_print_trigger(char *out, int max); // the spec back, returns its length
+
+#endif
@@ -0,0 +1,175 @@
+#include "cdc_stream.h"
+#include <string.h>
+
+// Queued CDC transfers
+// The bulk IN endpoint finishes writes in the order they were queued, so the
+// write buffers are used as a ring: the app fills and queues at txHead, the
+// write complete event (USB interrupt) frees at txTail. Each side only ever
+// changes its own counter, so neither needs to turn interrupts off.
+// The read complete event copies the packet into rxBuffer and queues the
+// next read straight away, so the host can keep sending while the app is
+// busy; cdc_stream_read() takes the bytes out of rxBuffer the same way.
+// A write longer than one buffer is copied straight into consecutive
+// buffers. All but the last are queued with MORE_DATA_PENDING, so the host
+// sees a single transfer of full packets (the buffer size is a multiple of
+// the 64 byte endpoint). The last is queued with DATA_COMPLETE, which ends
+// the transfer with a short packet, or with a zero length packet if it
+// happens to be a multiple of 64 bytes long, so the host never waits for
+// more.
+
+#define TX_BUFFERS APP_CDC_WRITE_QUEUE_DEPTH
+
+static uint8_t APP_MAKE_BUFFER_DMA_READY txBuffer[TX_BUFFERS][CDC_STREAM_BUFFER_SIZE];
+static uint8_t APP_MAKE_BUFFER_DMA_READY readBuffer[APP_READ_BUFFER_SIZE];
+static char rxBuffer[CDC_STREAM_RX_SIZE];
+
+static volatile unsigned int txHead, txTail;   // writes queued / completed
+static volatile unsigned int rxHead, rxTail;   // bytes received / taken
+static volatile bool readArmed;                // a read is queued
+
+void cdc_stream_setup(void) {
+    txHead = txTail = 0;
+    rxHead = rxTail = 0;
+    readArmed = false;
+}
+
+static void arm_read(void) {
+    USB_DEVICE_CDC_TRANSFER_HANDLE handle = USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID;
+    readArmed = true;
+    if (USB_DEVICE_CDC_Read(USB_DEVICE_CDC_INDEX_0, &handle, readBuffer,
+            APP_READ_BUFFER_SIZE) != USB_DEVICE_CDC_RESULT_OK) {
+        readArmed = false;          // cdc_stream_read() tries again
+    }
+}
+
+void cdc_stream_start(void) {
+    cdc_stream_setup();
+    arm_read();
+}
+
+void cdc_stream_stop(void) {
+    cdc_stream_setup();
+}
+
+int cdc_stream_free(void) {
+    return TX_BUFFERS - (int) (txHead - txTail);
+}
+
+int cdc_stream_room(void) {
+    return cdc_stream_free() * CDC_STREAM_BUFFER_SIZE;
+}
+
+// queue the next buffer with len bytes in it, false if the driver refused it
+static bool queue(int len, USB_DEVICE_CDC_TRANSFER_FLAGS flags) {
+    USB_DEVICE_CDC_TRANSFER_HANDLE handle = USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID;
+    unsigned int slot = txHead;
+
+    // count it before queueing, the write can complete before the call returns
+    txHead = slot + 1;
+    if (USB_DEVICE_CDC_Write(USB_DEVICE_CDC_INDEX_0, &handle, txBuffer[slot % TX_BUFFERS],
+            len, flags) != USB_DEVICE_CDC_RESULT_OK) {
+        txHead = slot;
+        return false;
+    }
+    return true;
+}
+
+// a write refused part way: if some of it is already queued (with
+// MORE_DATA_PENDING) the host transfer is still open, and the next write
+// would be appended to it, so end it with a zero length packet. The host
+// gets the front of the write, cut short; the caller is told none of it went.
+static int abandon(int sent) {
+    if (sent > 0) {
+        queue(0, USB_DEVICE_CDC_TRANSFER_FLAGS_DATA_COMPLETE);
+    }
+    return 0;
+}
+
+int cdc_stream_writev(const CDC_STREAM_PIECE *piece, int count) {
+    int total = 0, sent = 0, fill = 0;
+    int p;
+
+    for (p = 0; p < count; p++) {
+        total += piece[p].len;
+    }
+    if (total <= 0 || total > cdc_stream_room()) {
+        return 0;
+    }
+
+    for (p = 0; p < count; p++) {
+        const uint8_t *src = piece[p].data;
+        int left = piece[p].len;
+        while (left > 0) {
+            int n = CDC_STREAM_BUFFER_SIZE - fill;
+            if (n > left) {
+                n = left;
+            }
+            memcpy(&txBuffer[txHead % TX_BUFFERS][fill], src, n);
+            src += n;
+            left -= n;
+            fill += n;
+            if (fill == CDC_STREAM_BUFFER_SIZE && sent + fill < total) {
+                if (!queue(fill, USB_DEVICE_CDC_TRANSFER_FLAGS_MORE_DATA_PENDING)) {
+                    return abandon(sent);
+                }
+                sent += fill;
+                fill = 0;
+            }
+        }
+    }
+    if (!queue(fill, USB_DEVICE_CDC_TRANSFER_FLAGS_DATA_COMPLETE)) {
+        return abandon(sent);
+    }
+    return sent + fill;
+}
+
+int cdc_stream_write(const void *data, int len) {
+    CDC_STREAM_PIECE piece;
+    piece.data = data;
+    piece.len = len;
+    return cdc_stream_writev(&piece, 1);
+}
+
+int cdc_stream_read(char *data, int max) {
+    int n = 0;
+    if (!readArmed) {
+        arm_read();
+    }
+    while (n < max && rxTail != rxHead) {
+        data[n++] = rxBuffer[rxTail % CDC_STREAM_RX_SIZE];
+        rxTail++;
+    }
+    return n;
+}
+
+void cdc_stream_event(USB_DEVICE_CDC_EVENT event, void *pData) {
+    switch (event) {
+        case USB_DEVICE_CDC_EVENT_READ_COMPLETE: {
+            USB_DEVICE_CDC_EVENT_DATA_READ_COMPLETE *rd = pData;
+            unsigned int k;
+            if (!readArmed) {
+                break;              // cancelled by a reset
+            }
+            readArmed = false;
+            if (rd->status != USB_DEVICE_CDC_RESULT_OK) {
+                break;
+            }
+            // bytes that don't fit are dropped, the app is too far behind
+            for (k = 0; k < rd->length && rxHead - rxTail < CDC_STREAM_RX_SIZE; k++) {
+                rxBuffer[rxHead % CDC_STREAM_RX_SIZE] = readBuffer[k];
+                rxHead++;
+            }
+            arm_read();
+            break;
+        }
+
+        case USB_DEVICE_CDC_EVENT_WRITE_COMPLETE:
+            if (txTail != txHead) {
+                txTail++;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef CDC_STREAM_H__
+#define CDC_STREAM_H__
+// Header file for cdc_stream.c
+// queued CDC transfers: up to APP_CDC_WRITE_QUEUE_DEPTH writes in flight from
+// a pool of DMA-ready buffers, and a read that is re-armed as soon as it
+// completes, so the app never waits on a transfer to send or receive
+
+#include "system_config.h"
+#include "system_definitions.h"
+
+#define CDC_STREAM_BUFFER_SIZE APP_CDC_WRITE_BUFFER_SIZE // bytes per write buffer
+#define CDC_STREAM_MAX_WRITE (APP_CDC_WRITE_QUEUE_DEPTH * CDC_STREAM_BUFFER_SIZE) // longest write
+#define CDC_STREAM_RX_SIZE 256                  // received bytes not yet taken by cdc_stream_read()
+
+typedef struct {
+    const void *data;
+    int len;
+} CDC_STREAM_PIECE;                      // one part of a gathered write
+
+void cdc_stream_setup(void);             // empty the pool and the receive buffer
+void cdc_stream_start(void);             // call once configured: arms the first read
+void cdc_stream_stop(void);              // call on reset: forgets the transfers in flight
+int cdc_stream_free(void);               // write buffers not in flight
+int cdc_stream_room(void);               // longest write that would be accepted now
+int cdc_stream_write(const void *data, int len); // queue len bytes as one transfer, split over
+                                                 // as many buffers as it takes; returns len, or 0
+                                                 // if there isn't room for all of it (nothing is
+                                                 // queued) or the driver refuses a buffer part way
+                                                 // (the host may get the front of it, cut short)
+int cdc_stream_writev(const CDC_STREAM_PIECE *piece, int count); // the same for several pieces
+                                                 // (e.g. a header and a capture) sent back to back
+int cdc_stream_read(char *data, int max); // copy out up to max received bytes, returns the count
+void cdc_stream_event(USB_DEVICE_CDC_EVENT event, void *pData); // pass on the CDC read/write
+                                                                // complete events
+
+#endif
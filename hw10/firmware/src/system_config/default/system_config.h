@@ -101,7 +101,15 @@ extern "C" {
 /* CDC Transfer Queue Size for both read and
    write. Applicable to all instances of the
    function driver */
-#define USB_DEVICE_CDC_QUEUE_DEPTH_COMBINED 3
+#define USB_DEVICE_CDC_QUEUE_DEPTH_COMBINED (1 + APP_CDC_WRITE_QUEUE_DEPTH + 1)
+
+/* CDC writes the application keeps in flight (cdc_stream.c), a power of 2.
+ * The combined queue above is 1 read + these writes + 1 notification */
+#define APP_CDC_WRITE_QUEUE_DEPTH 4
+
+/* Size of each of those write buffers, a multiple of the 64 byte bulk
+ * endpoint. One write can be up to depth * size bytes long */
+#define APP_CDC_WRITE_BUFFER_SIZE 512
 
 /* Application USB Device CDC Read Buffer Size. This should be a multiple of
  * the CDC Bulk Endpoint size */
@@ -165,7 +165,7 @@ SYSTEM_OBJECTS sysObj;
     const USB_DEVICE_CDC_INIT cdcInit0 =
     {
         .queueSizeRead = 1,
-        .queueSizeWrite = 1,
+        .queueSizeWrite = APP_CDC_WRITE_QUEUE_DEPTH,
         .queueSizeSerialStateNotification = 1
     };
 /**************************************************
@@ -460,6 +460,17 @@ void SYS_Initialize ( void* data )
     /* Set Sub-priority of USB interrupt source */
     SYS_INT_VectorSubprioritySet(INT_VECTOR_USB1, INT_SUBPRIORITY_LEVEL0);
 
+    /* Timer2 runs the USB driver and device layer tasks at 1 kHz. It has the
+     * USB interrupt's priority, so the two never interrupt each other */
+    T2CON = 0;
+    T2CONbits.TCKPS = 0b110;    // 1:64 prescaler, 750 kHz
+    PR2 = 750 - 1;              // 1 kHz
+    TMR2 = 0;
+    IPC2bits.T2IP = 4;
+    IFS0bits.T2IF = 0;
+    IEC0bits.T2IE = 1;
+    T2CONbits.ON = 1;
+
     /* Initialize System Services */
 
     /*** Interrupt Service Initialization Code ***/
@@ -75,6 +75,17 @@ void __ISR(_USB_1_VECTOR, ipl4AUTO) _IntHandlerUSBInstance0(void)
     DRV_USBFS_Tasks_ISR(sysObj.drvUSBObject);
 }
 
+void __ISR(_TIMER_2_VECTOR, ipl4AUTO) _IntHandlerUSBTasks(void)
+{
+    IFS0bits.T2IF = 0;
+
+    /* USB FS Driver Task Routine */
+    DRV_USBFS_Tasks(sysObj.drvUSBObject);
+
+    /* USB Device layer tasks routine */
+    USB_DEVICE_Tasks(sysObj.usbDevObject0);
+}
+
 /*******************************************************************************
  End of File
 */
@@ -77,13 +77,9 @@ void SYS_Tasks ( void )
 
     /* Maintain Middleware & Other Libraries */
 
-    
-    /* USB FS Driver Task Routine */ 
-     DRV_USBFS_Tasks(sysObj.drvUSBObject);
-     
- 
-    /* USB Device layer tasks routine */ 
-    USB_DEVICE_Tasks(sysObj.usbDevObject0);
+    /* The USB driver and device layer tasks run from the Timer2 interrupt
+     * (system_interrupt.c), so nothing the application does here can
+     * hold them up */
 
     /* Maintain the application's state machine. */
     APP_Tasks();
@@ -0,0 +1,384 @@
+// Capture the hw10 IMU stream over the CDC port
+//
+//   cc -O2 -o capture capture.c
+//   ./capture [-d /dev/ttyACM0] [-r hz] [-c "ax ay az:maf"] [-n decimation]
+//             [-l rows] [-m maf] [-i iir] [-T "column mode level" [-p rows]]
+//             [-t seconds] [-o file.csv | file.npy | -]
+//
+// Sets up the capture (the "hz", "cols", "dec", "len", "maf", "iir", "trig"
+// and "pre" commands, see APP_Command in firmware/src/app.c), sends "start"
+// and decodes the binary rows (see APP_STREAM_SYNC0 in firmware/src/app.h).
+// With -l the device collects that many rows and then uploads them; with -T
+// as well it waits for the trigger and keeps -p rows from before it, like a
+// single shot on a scope. Without -l the rows stream until -t seconds have
+// passed or Ctrl-C, and then "stop" is sent. Every second it prints the rate actually received, the rows lost
+// so far (gaps in the sequence numbers) and the latest row, so the stream
+// can be watched live.
+//
+// Output, one line per row: seq and the columns, with seq counted on past
+// 65535. A .csv file gets a header line; a .npy file is an int32 array of
+// shape (rows, 1 + columns) for numpy.load(). To plot while capturing,
+// write CSV to stdout (-o -) and pipe it into a plotter.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/time.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define SYNC0 0xA5
+#define SYNC1 0x5A
+#define HEADER 5                // sync, sequence, column count
+#define MAX_COLUMNS 8
+#define NPY_HEADER 128          // header block size, the shape is filled in at the end
+
+static volatile sig_atomic_t stopping;
+
+static void on_signal(int sig) {
+    (void) sig;
+    stopping = 1;
+}
+
+static double now(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+static int open_port(const char *dev) {
+    struct termios tio;
+    int fd = open(dev, O_RDWR | O_NOCTTY);
+    if (fd < 0) {
+        return -1;
+    }
+    // raw bytes both ways; the baud rate means nothing to a CDC device
+    tcgetattr(fd, &tio);
+    cfmakeraw(&tio);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    tcsetattr(fd, TCSANOW, &tio);
+    tcflush(fd, TCIOFLUSH);
+    return fd;
+}
+
+static void send_line(int fd, const char *line) {
+    if (write(fd, line, strlen(line)) < 0) {
+        perror("write");
+    }
+}
+
+// read whatever arrives within ms milliseconds, returns the byte count
+static int read_for(int fd, unsigned char *buf, int max, int ms) {
+    fd_set set;
+    struct timeval tv;
+    int n;
+    FD_ZERO(&set);
+    FD_SET(fd, &set);
+    tv.tv_sec = ms / 1000;
+    tv.tv_usec = (ms % 1000) * 1000;
+    if (select(fd + 1, &set, NULL, NULL, &tv) <= 0) {
+        return 0;
+    }
+    n = read(fd, buf, max);
+    return n < 0 ? 0 : n;
+}
+
+// text between frames is collected here, one line at a time; the last
+// complete line is in reply
+static char text[256], reply[256];
+static int textLength;
+
+// add a byte that isn't part of a frame, returns 1 when a line is complete
+static int text_byte(unsigned char b) {
+    if (b == '\n' || b == '\r') {
+        text[textLength] = 0;
+        textLength = 0;
+        if (text[0] != 0) {
+            strcpy(reply, text);
+            return 1;
+        }
+    } else if (b < 0x20 || b >= 0x7F) {
+        textLength = 0;         // binary, not a reply
+    } else if (textLength < (int) sizeof(text) - 1) {
+        text[textLength++] = b;
+    }
+    return 0;
+}
+
+// the reply line containing prefix, from the rest of the line on
+static const char *reply_to(const char *prefix) {
+    return strstr(reply, prefix);
+}
+
+// send a command and wait up to 1 s for the answer that contains prefix
+static const char *command(int fd, const char *cmd, const char *prefix) {
+    unsigned char buf[256];
+    double end = now() + 1.0;
+    send_line(fd, cmd);
+    while (now() < end) {
+        int n = read_for(fd, buf, sizeof(buf), 20);
+        int k;
+        for (k = 0; k < n; k++) {
+            if (text_byte(buf[k]) && reply_to(prefix) != NULL) {
+                return reply_to(prefix);
+            }
+        }
+    }
+    return NULL;
+}
+
+static void npy_header(FILE *f, long rows, int columns) {
+    char h[NPY_HEADER];
+    int n;
+    memset(h, ' ', sizeof(h));
+    memcpy(h, "\x93NUMPY\x01\x00", 8);
+    n = snprintf(h + 10, sizeof(h) - 10,
+            "{'descr': '<i4', 'fortran_order': False, 'shape': (%ld, %d), }", rows, columns + 1);
+    h[10 + n] = ' ';
+    h[8] = (NPY_HEADER - 10) & 0xFF;
+    h[9] = (NPY_HEADER - 10) >> 8;
+    h[NPY_HEADER - 1] = '\n';
+    fseek(f, 0, SEEK_SET);
+    fwrite(h, 1, sizeof(h), f);
+}
+
+// frame decoder state
+static FILE *f;
+static int npy;
+static int columns;             // as set up, frames with another count are skipped
+static unsigned char frame[HEADER + 2 * MAX_COLUMNS];
+static int have;                // bytes of frame collected
+static long rows, lost, skipped;
+static long long seq = -1;      // last sequence number, counted on past 16 bits
+static int32_t latest[1 + MAX_COLUMNS];
+
+static void write_frame(void) {
+    unsigned s = frame[2] | frame[3] << 8;
+    int c;
+    if (seq < 0) {
+        seq = s;
+    } else {
+        long long next = seq + 1;
+        long gap = (long) ((s - (unsigned) next) & 0xFFFF);
+        lost += gap;
+        seq = next + gap;
+    }
+    latest[0] = (int32_t) seq;
+    for (c = 0; c < columns; c++) {
+        latest[1 + c] = (short) (frame[HEADER + 2 * c] | frame[HEADER + 1 + 2 * c] << 8);
+    }
+    if (npy) {
+        fwrite(latest, sizeof(latest[0]), 1 + columns, f);
+    } else {
+        fprintf(f, "%d", latest[0]);
+        for (c = 0; c < columns; c++) {
+            fprintf(f, ",%d", latest[1 + c]);
+        }
+        fprintf(f, "\n");
+    }
+    rows++;
+}
+
+// decode n received bytes; returns 1 if a reply line containing prefix was among them
+static int feed(const unsigned char *buf, int n, const char *prefix) {
+    int k, done = 0;
+    for (k = 0; k < n; k++) {
+        unsigned char b = buf[k];
+        // look for the sync bytes, anything else between frames is text
+        if (have == 0 && b != SYNC0) {
+            skipped++;
+            if (text_byte(b) && reply_to(prefix) != NULL) {
+                done = 1;
+            }
+            continue;
+        }
+        if ((have == 1 && b != SYNC1) || (have == 4 && b != columns)) {
+            have = b == SYNC0;
+            skipped++;
+            continue;
+        }
+        frame[have++] = b;
+        if (have == HEADER + 2 * columns) {
+            have = 0;
+            write_frame();
+        }
+    }
+    return done;
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: capture [-d device] [-r hz] [-c columns] [-n decimation] [-l rows]\n"
+            "               [-m maf] [-i iir] [-T \"column mode level\" [-p rows]]\n"
+            "               [-t seconds] [-o file.csv|file.npy|-]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    const char *dev = "/dev/ttyACM0";
+    const char *out = "capture.csv";
+    const char *cols = NULL, *trig = NULL, *r;
+    int hz = 400, dec = 1, len = 0, maf = 0, iir = -1, pre = 0;
+    double seconds = 0;         // 0: until Ctrl-C or, with -l, the end of the upload
+    int opt, fd, finished = 0;
+    char line[128], names[200];
+    unsigned char buf[4096];
+    long lastRows = 0;
+    double start, lastReport, end;
+
+    while ((opt = getopt(argc, argv, "d:r:c:n:l:m:i:T:p:t:o:h")) != -1) {
+        switch (opt) {
+            case 'd': dev = optarg; break;
+            case 'r': hz = atoi(optarg); break;
+            case 'c': cols = optarg; break;
+            case 'n': dec = atoi(optarg); break;
+            case 'l': len = atoi(optarg); break;
+            case 'm': maf = atoi(optarg); break;
+            case 'i': iir = atoi(optarg); break;
+            case 'T': trig = optarg; break;
+            case 'p': pre = atoi(optarg); break;
+            case 't': seconds = atof(optarg); break;
+            case 'o': out = optarg; break;
+            default: usage();
+        }
+    }
+
+    fd = open_port(dev);
+    if (fd < 0) {
+        fprintf(stderr, "%s: %s\n", dev, strerror(errno));
+        return 1;
+    }
+
+    // stop anything left running, then set up
+    send_line(fd, "\nstop\n");
+    while (read_for(fd, buf, sizeof(buf), 200) > 0) {
+    }
+    snprintf(line, sizeof(line), "hz %d\n", hz);
+    if (command(fd, line, "hz ") == NULL) {
+        fprintf(stderr, "no answer from %s, is it running the hw10 firmware?\n", dev);
+        return 1;
+    }
+    command(fd, "fmt bin\n", "fmt ");
+    if (cols != NULL) {
+        snprintf(line, sizeof(line), "cols %s\n", cols);
+        command(fd, line, "cols ");
+    }
+    snprintf(line, sizeof(line), "dec %d\n", dec);
+    command(fd, line, "dec ");
+    snprintf(line, sizeof(line), "len %d\n", len);
+    command(fd, line, "len ");
+    if (maf > 0) {
+        snprintf(line, sizeof(line), "maf %d\n", maf);
+        command(fd, line, "maf ");
+    }
+    if (iir >= 0) {
+        snprintf(line, sizeof(line), "iir %d\n", iir);
+        command(fd, line, "iir ");
+    }
+    // a trigger the device doesn't take leaves it off
+    command(fd, "trig off\n", "trig ");
+    if (trig != NULL) {
+        snprintf(line, sizeof(line), "trig %s\n", trig);
+        if ((r = command(fd, line, "trig ")) == NULL || strcmp(r, "trig off") == 0) {
+            fprintf(stderr, "bad trigger \"%s\", see -T\n", trig);
+            return 1;
+        }
+    }
+    snprintf(line, sizeof(line), "pre %d\n", pre);
+    command(fd, line, "pre ");
+    if ((r = command(fd, "?\n", "hz ")) == NULL || strstr(r, " cols ") == NULL) {
+        fprintf(stderr, "no settings from %s\n", dev);
+        return 1;
+    }
+    fprintf(stderr, "device: %s\n", r);
+
+    // the column names, as the device has them
+    snprintf(names, sizeof(names), "%s", strstr(r, " cols ") + 6);
+    columns = 1;
+    for (r = names; *r; r++) {
+        columns += *r == ' ';
+    }
+    if (columns > MAX_COLUMNS) {
+        return 1;
+    }
+
+    npy = strlen(out) > 4 && strcmp(out + strlen(out) - 4, ".npy") == 0;
+    f = strcmp(out, "-") == 0 ? stdout : fopen(out, "wb");
+    if (f == NULL) {
+        fprintf(stderr, "%s: %s\n", out, strerror(errno));
+        return 1;
+    }
+    if (npy) {
+        npy_header(f, 0, columns);
+    } else {
+        char *p;
+        for (p = names; *p; p++) {
+            if (*p == ' ') {
+                *p = ',';
+            }
+        }
+        fprintf(f, "seq,%s\n", names);
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    send_line(fd, "start\n");
+    start = lastReport = now();
+    if (len > 0) {
+        fprintf(stderr, trig != NULL ? "waiting for the trigger, then %d rows\n" : "collecting %d rows\n", len);
+    }
+
+    while (!stopping && !finished && (seconds <= 0 || now() - start < seconds)) {
+        int n = read_for(fd, buf, sizeof(buf), 100);
+        finished = feed(buf, n, "done ");
+
+        if (now() - lastReport >= 1.0) {
+            double t = now();
+            int c;
+            fprintf(stderr, "%8.1f s  %7.1f rows/s  %ld lost ", t - start,
+                    (rows - lastRows) / (t - lastReport), lost);
+            for (c = 0; c < columns; c++) {
+                fprintf(stderr, " %6d", latest[1 + c]);
+            }
+            fprintf(stderr, "\n");
+            lastRows = rows;
+            lastReport = t;
+            fflush(f);
+        }
+    }
+    end = now();
+
+    if (!finished) {
+        // keep the frames still on their way until the device confirms the stop
+        send_line(fd, "stop\n");
+        while (!finished && now() - end < 1.0) {
+            int n = read_for(fd, buf, sizeof(buf), 100);
+            finished = feed(buf, n, "stop ");
+        }
+        if (finished) {
+            long sent, dropped;
+            if (sscanf(reply_to("stop "), "stop %ld %ld", &sent, &dropped) == 2) {
+                fprintf(stderr, "device: %ld rows, %ld dropped for lack of buffers\n", sent, dropped);
+            }
+        }
+    }
+    fprintf(stderr, "%ld rows in %.1f s (%.1f/s), %ld lost, %ld bytes skipped\n",
+            rows, end - start, rows / (end - start), lost, skipped);
+    if (trig != NULL && finished && len > 0) {
+        fprintf(stderr, "trigger at seq %d\n", pre < len ? pre : len - 1);
+    }
+
+    if (npy && f != stdout) {
+        npy_header(f, rows, columns);
+    }
+    if (f != stdout) {
+        fclose(f);
+    }
+    close(fd);
+    return 0;
+}
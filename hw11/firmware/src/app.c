@@ -6,6 +6,7 @@
 
 #include "app.h"
 #include <stdio.h>
+#include <string.h>
 #include <xc.h>
 
 // *****************************************************************************
@@ -14,9 +15,25 @@
 // *****************************************************************************
 // *****************************************************************************
 
-#define LSM6DS33 0b1101011  // IMU address
-
-int i = 0;            // for sending data every other cycle (to make it not as jumpy)
+#define IMU_READ_LENGTH 14  // from OUT_TEMP_L: temperature, gyro x,y,z, accelerometer x,y,z
+#define LCD_FRAMES 100     // update the LCD every 100 frames (ms), it's too slow for every report
+#define LCD_CHARS 4        // characters of it drawn per frame, ~0.35 ms
+#define CHART_FRAMES 20    // a line of the LCD's chart every 20 frames (ms): 88 lines, 1.8 s
+#define CHART_TOP 72       // first row of the chart, under the text
+
+bool lcdReady = false;        // LCD initialized, and its first screen drawn
+uint32_t lcdFrame = 0;        // frame of the last LCD update
+uint32_t chartFrame = 0;      // frame of the last line of the chart
+bool chartGyro = false;       // chart the gyro rather than the accelerometer
+const unsigned short chartColors[3] = {RED, GREEN, CYAN}; // x, y, z
+int sumX = 0, sumY = 0;       // counts sent since the last LCD update
+int telemX = 0, telemY = 0;   // counts sent since the last telemetry line
+
+char rx[64];                  // command line being received over CDC
+int rxPos = 0;
+char reply[96];               // answer to the last command, waiting to be written
+int replyLength = 0;
+unsigned long i2cRate = 0;    // SCL Hz the IMU is read at
 
 // *****************************************************************************
 /* Application Data
@@ -34,7 +51,10 @@ APP_DATA appData;
 
 /* Mouse Report */
 MOUSE_REPORT mouseReport APP_MAKE_BUFFER_DMA_READY;
-MOUSE_REPORT mouseReportPrevious APP_MAKE_BUFFER_DMA_READY;
+
+/* CDC buffers */
+uint8_t APP_MAKE_BUFFER_DMA_READY readBuffer[APP_READ_BUFFER_SIZE];
+uint8_t APP_MAKE_BUFFER_DMA_READY writeBuffer[128];
 
 
 // *****************************************************************************
@@ -66,7 +86,9 @@ void APP_USBDeviceHIDEventHandler(USB_DEVICE_HID_INDEX hidInstance,
             /* Acknowledge the Control Write Transfer */
             USB_DEVICE_ControlStatus(appData->deviceHandle, USB_DEVICE_CONTROL_STATUS_OK);
 
-            /* save Idle rate received from Host */
+            /* save Idle rate received from Host. The time since the last report
+               is measured from reportFrame, so if it is already longer than the
+               new duration the next frame sends a report, as the HID spec asks */
             appData->idleRate = ((USB_DEVICE_HID_EVENT_DATA_SET_IDLE*) eventData)->duration;
             break;
 
@@ -113,6 +135,76 @@ void APP_USBDeviceHIDEventHandler(USB_DEVICE_HID_INDEX hidInstance,
     }
 }
 
+/*******************************************************
+ * USB CDC Device Events - Application Event Handler
+ *******************************************************/
+
+USB_DEVICE_CDC_EVENT_RESPONSE APP_USBDeviceCDCEventHandler(USB_DEVICE_CDC_INDEX index,
+        USB_DEVICE_CDC_EVENT event, void * pData, uintptr_t userData) {
+    APP_DATA * appDataObject = (APP_DATA *) userData;
+    USB_CDC_CONTROL_LINE_STATE * controlLineStateData;
+
+    switch (event) {
+        case USB_DEVICE_CDC_EVENT_GET_LINE_CODING:
+
+            /* The host wants to know the current line coding */
+            USB_DEVICE_ControlSend(appDataObject->deviceHandle,
+                    &appDataObject->getLineCodingData, sizeof (USB_CDC_LINE_CODING));
+            break;
+
+        case USB_DEVICE_CDC_EVENT_SET_LINE_CODING:
+
+            /* The host sets the line coding, receive it */
+            USB_DEVICE_ControlReceive(appDataObject->deviceHandle,
+                    &appDataObject->setLineCodingData, sizeof (USB_CDC_LINE_CODING));
+            break;
+
+        case USB_DEVICE_CDC_EVENT_SET_CONTROL_LINE_STATE:
+
+            /* The host is setting the control line state, accept it */
+            controlLineStateData = (USB_CDC_CONTROL_LINE_STATE *) pData;
+            appDataObject->controlLineStateData.dtr = controlLineStateData->dtr;
+            appDataObject->controlLineStateData.carrier = controlLineStateData->carrier;
+            USB_DEVICE_ControlStatus(appDataObject->deviceHandle, USB_DEVICE_CONTROL_STATUS_OK);
+            break;
+
+        case USB_DEVICE_CDC_EVENT_SEND_BREAK:
+
+            /* Read the break duration and complete the control transfer */
+            appDataObject->breakData = ((USB_DEVICE_CDC_EVENT_DATA_SEND_BREAK *) pData)->breakDuration;
+            USB_DEVICE_ControlStatus(appDataObject->deviceHandle, USB_DEVICE_CONTROL_STATUS_OK);
+            break;
+
+        case USB_DEVICE_CDC_EVENT_READ_COMPLETE:
+
+            /* The host has sent some data */
+            appDataObject->readLength = ((USB_DEVICE_CDC_EVENT_DATA_READ_COMPLETE *) pData)->length;
+            appDataObject->isReadComplete = true;
+            break;
+
+        case USB_DEVICE_CDC_EVENT_CONTROL_TRANSFER_DATA_RECEIVED:
+
+            /* The data stage of the last control transfer is
+             * complete. For now we accept all the data */
+            USB_DEVICE_ControlStatus(appDataObject->deviceHandle, USB_DEVICE_CONTROL_STATUS_OK);
+            break;
+
+        case USB_DEVICE_CDC_EVENT_CONTROL_TRANSFER_DATA_SENT:
+            break;
+
+        case USB_DEVICE_CDC_EVENT_WRITE_COMPLETE:
+
+            /* The last write is done, the next one can be scheduled */
+            appDataObject->isWriteComplete = true;
+            break;
+
+        default:
+            break;
+    }
+
+    return USB_DEVICE_CDC_EVENT_RESPONSE_NONE;
+}
+
 /*******************************************************************************
   Function:
     void APP_USBDeviceEventHandler (USB_DEVICE_EVENT event,
@@ -131,10 +223,10 @@ void APP_USBDeviceEventHandler(USB_DEVICE_EVENT event, void * eventData, uintptr
     USB_DEVICE_EVENT_DATA_CONFIGURED * configurationValue;
     switch (event) {
         case USB_DEVICE_EVENT_SOF:
-            /* This event is used for switch debounce. This flag is reset
-             * by the switch process routine. */
+            /* A new 1 ms frame started: the mouse task runs once per frame.
+             * The flag is reset by the mouse task. */
+            appData.frameCount++;
             appData.sofEventHasOccurred = true;
-            appData.setIdleTimer++;
             break;
         case USB_DEVICE_EVENT_RESET:
         case USB_DEVICE_EVENT_DECONFIGURED:
@@ -143,6 +235,9 @@ void APP_USBDeviceEventHandler(USB_DEVICE_EVENT event, void * eventData, uintptr
 
             appData.isConfigured = false;
             appData.isMouseReportSendBusy = false;
+            appData.isReadComplete = true;
+            appData.readLength = 0;
+            appData.isWriteComplete = true;
             appData.state = APP_STATE_WAIT_FOR_CONFIGURATION;
             //appData.emulateMouse = true;
             //BSP_LEDOn ( APP_USB_LED_1 );
@@ -166,6 +261,10 @@ void APP_USBDeviceEventHandler(USB_DEVICE_EVENT event, void * eventData, uintptr
 
                 USB_DEVICE_HID_EventHandlerSet(appData.hidInstance,
                         APP_USBDeviceHIDEventHandler, (uintptr_t) & appData);
+
+                /* and the CDC one; each function has its own transfer queue */
+                USB_DEVICE_CDC_EventHandlerSet(USB_DEVICE_CDC_INDEX_0,
+                        APP_USBDeviceCDCEventHandler, (uintptr_t) & appData);
             }
             break;
 
@@ -195,6 +294,192 @@ void APP_USBDeviceEventHandler(USB_DEVICE_EVENT event, void * eventData, uintptr
     }
 }
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Runs one command line from the CDC channel and answers with the settings:
+ *   dead N, gain N, accel N             set the tilt engine (see tilt.h)
+ *   smooth N, gate N                    set the attitude filter (see attitude.h)
+ *   stream N                            telemetry every N frames (ms), 0 = off
+ *   ?                                   just the settings
+ * or with the IMU's full scale (see imu_range.h):
+ *   range G DPS                         accelerometer 2|4|8|16 g, gyro 245|500|1000|2000
+ *                                       dps, 0 for either switches it automatically
+ *   range                               just the ranges in use
+ * or with the I2C bus to it:
+ *   i2c KHZ                             SCL rate, 100, 400 or 1000 (past the
+ *                                       LSM6DS33's 400, so not for this board)
+ *   i2c                                 just the rate
+ * or with the chart on the LCD:
+ *   chart accel, chart gyro             what it plots, x,y,z, scaled automatically
+ * or with the calibration (see imu_cal.h):
+ *   cal gyro                            average the gyro bias, board still
+ *   cal pos                             average one of the six positions, board
+ *                                       still with an axis straight up or down;
+ *                                       the answer comes when it's done
+ *   cal clear                           back to no correction
+ *   cal save                            keep it in flash for the next power up
+ *   cal                                 just the calibration
+ * or with the temperature drift of the gyro bias (see gyro_drift.h), which is
+ * learned again after a new gyro calibration:
+ *   drift clear                         forget what was learned
+ *   drift                               just the drift */
+static void APP_Command(const char *line) {
+    char name[8];
+    int value = 0;
+    int n = sscanf(line, "%7s %d", name, &value);
+
+    if (n >= 1 && strcmp(name, "cal") == 0) {
+        char what[8] = "";
+        sscanf(line, "cal %7s", what);
+        if (strcmp(what, "gyro") == 0 || strcmp(what, "pos") == 0) {
+            if (what[0] == 'g') {
+                gyro_drift_setup();
+            }
+            imu_cal_start(what[0] == 'g' ? IMU_CAL_GYRO : IMU_CAL_POSITION);
+            return;                 // answered when the average is done
+        } else if (strcmp(what, "clear") == 0) {
+            imu_cal_clear();
+            gyro_drift_setup();
+        } else if (strcmp(what, "save") == 0) {
+            if (!imu_cal_save()) {
+                replyLength = sprintf(reply, "cal save failed\r\n");
+                return;
+            }
+        } else if (what[0] != 0) {
+            replyLength = sprintf(reply, "? %s\r\n", "cal gyro|pos|clear|save");
+            return;
+        }
+        replyLength = imu_cal_print(reply, sizeof (reply));
+        return;
+    }
+    if (n >= 1 && strcmp(name, "range") == 0) {
+        int g, dps;
+        if (sscanf(line, "range %d %d", &g, &dps) == 2 && !imu_range_set(g, dps)) {
+            replyLength = sprintf(reply, "? %s\r\n", "range 0|2|4|8|16 0|245|500|1000|2000");
+            return;
+        }
+        replyLength = imu_range_print(reply, sizeof (reply));
+        return;
+    }
+    if (n >= 1 && strcmp(name, "i2c") == 0) {
+        if (n == 2) {
+            unsigned long hz = value > 0 ? i2c_master_speed(value * 1000UL) : 0;
+            if (hz == 0) {
+                replyLength = sprintf(reply, "? %s\r\n", "i2c 100|400|1000");
+                return;
+            }
+            i2cRate = hz;
+        }
+        replyLength = sprintf(reply, "i2c %lu Hz\r\n", i2cRate);
+        return;
+    }
+    if (n >= 1 && strcmp(name, "chart") == 0) {
+        char what[8] = "";
+        sscanf(line, "chart %7s", what);
+        if (strcmp(what, "accel") == 0 || strcmp(what, "gyro") == 0) {
+            chartGyro = what[0] == 'g';
+            strip_chart_scale(0, 0);    // start the scale again for the new values
+        } else if (what[0] != 0) {
+            replyLength = sprintf(reply, "? %s\r\n", "chart accel|gyro");
+            return;
+        }
+        replyLength = sprintf(reply, "chart %s\r\n", chartGyro ? "gyro" : "accel");
+        return;
+    }
+    if (n >= 1 && strcmp(name, "drift") == 0) {
+        if (strcmp(line, "drift clear") == 0) {
+            gyro_drift_setup();
+        }
+        replyLength = gyro_drift_print(reply, sizeof (reply));
+        return;
+    }
+    if (n == 2 && strcmp(name, "dead") == 0) {
+        tiltConfig.deadZone = value < 0 ? 0 : (value > TILT_MAX_DEAD_ZONE ? TILT_MAX_DEAD_ZONE : value);
+    } else if (n == 2 && strcmp(name, "gain") == 0) {
+        tiltConfig.gain = value < 0 ? 0 : (value > TILT_MAX_GAIN ? TILT_MAX_GAIN : value);
+    } else if (n == 2 && strcmp(name, "accel") == 0) {
+        tiltConfig.accel = value < 0 ? 0 : (value > TILT_MAX_GAIN ? TILT_MAX_GAIN : value);
+    } else if (n == 2 && strcmp(name, "smooth") == 0) {
+        attitudeConfig.shift = value < 0 ? 0 : (value > 15 ? 15 : value);
+    } else if (n == 2 && strcmp(name, "gate") == 0) {
+        attitudeConfig.gate = value < 0 ? 0 : value;
+    } else if (n == 2 && strcmp(name, "stream") == 0) {
+        appData.telemetryPeriod = value < 0 ? 0 : value;
+        appData.telemetryFrame = appData.frameCount;
+    } else if (n != 1 || strcmp(name, "?") != 0) {
+        replyLength = sprintf(reply, "? %s\r\n", "dead|gain|accel|smooth|gate|stream N");
+        return;
+    }
+    replyLength = snprintf(reply, sizeof (reply), "dead %d gain %d accel %d smooth %d gate %d stream %lu\r\n",
+            tiltConfig.deadZone, tiltConfig.gain, tiltConfig.accel, attitudeConfig.shift,
+            attitudeConfig.gate, (unsigned long) appData.telemetryPeriod);
+    if (replyLength >= (int) sizeof (reply)) {
+        replyLength = sizeof (reply) - 1;
+    }
+}
+
+/* CDC side of the composite device, run once per frame after the mouse report:
+ * collects command lines, answers them, and streams the IMU data and pointer
+ * motion as "frame ax ay az gx gy gz dx dy roll pitch yawrate" (calibrated, in the
+ * units of imu_range.h whatever the range, attitude in 1/100 degree and 1/100 degree/s) */
+static void APP_CDCTasks(uint32_t frame) {
+    uint32_t k;
+
+    if (appData.isReadComplete) {
+        for (k = 0; k < appData.readLength; k++) {
+            char c = (char) readBuffer[k];
+            if (c == '\n' || c == '\r') {
+                if (rxPos > 0) {
+                    rx[rxPos] = 0;
+                    APP_Command(rx);
+                    rxPos = 0;
+                }
+            } else if (rxPos < (int) sizeof (rx) - 1) {
+                rx[rxPos++] = c;
+            }
+        }
+        appData.readLength = 0;
+        appData.isReadComplete = false;
+        if (USB_DEVICE_CDC_Read(USB_DEVICE_CDC_INDEX_0, &appData.readTransferHandle,
+                readBuffer, APP_READ_BUFFER_SIZE) != USB_DEVICE_CDC_RESULT_OK) {
+            appData.isReadComplete = true; // try again next frame
+        }
+    }
+
+    if (!appData.isWriteComplete) {
+        return;
+    }
+    if (replyLength > 0) {
+        memcpy(writeBuffer, reply, replyLength);
+        k = replyLength;
+        replyLength = 0;
+    } else if (appData.telemetryPeriod != 0 && appData.imuDataValid
+            && frame - appData.telemetryFrame >= appData.telemetryPeriod) {
+        const long *g = appData.imu.gyro, *a = appData.imu.accel;
+        k = snprintf((char *) writeBuffer, sizeof (writeBuffer),
+                "%lu %ld %ld %ld %ld %ld %ld %d %d %d %d %d\r\n",
+                (unsigned long) frame, a[0], a[1], a[2], g[0], g[1], g[2], telemX, telemY,
+                attitude_roll(), attitude_pitch(), attitude_yaw_rate());
+        if (k >= (int) sizeof (writeBuffer)) {
+            k = sizeof (writeBuffer) - 1;
+        }
+        telemX = 0;
+        telemY = 0;
+        appData.telemetryFrame = frame;
+    } else {
+        return;
+    }
+    appData.isWriteComplete = false;
+    if (USB_DEVICE_CDC_Write(USB_DEVICE_CDC_INDEX_0, &appData.writeTransferHandle,
+            writeBuffer, k, USB_DEVICE_CDC_TRANSFER_FLAGS_DATA_COMPLETE) != USB_DEVICE_CDC_RESULT_OK) {
+        appData.isWriteComplete = true;
+    }
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Initialization and State Machine Functions
@@ -216,30 +501,37 @@ void APP_Initialize(void) {
     //appData.emulateMouse = true;
     appData.hidInstance = 0;
     appData.isMouseReportSendBusy = false;
+
+    /* CDC: initial line coding, no transfers in progress, telemetry off */
+    appData.getLineCodingData.dwDTERate = 9600;
+    appData.getLineCodingData.bCharFormat = 0;
+    appData.getLineCodingData.bParityType = 0;
+    appData.getLineCodingData.bDataBits = 8;
+    appData.readTransferHandle = USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID;
+    appData.writeTransferHandle = USB_DEVICE_CDC_TRANSFER_HANDLE_INVALID;
+    appData.isReadComplete = true;
+    appData.readLength = 0;
+    appData.isWriteComplete = true;
+    appData.telemetryPeriod = 0;
     
     // other initializations
     BMXCONbits.BMXWSDRM = 0x0;                                   // 0 data RAM access wait states
     INTCONbits.MVEC = 0x1;                                       // enable multi vector interrupts
     DDPCONbits.JTAGEN = 0;                                       // disable JTAG to get pins back
-    i2c_master_setup();                                          // set up I2C2 as master, at 400 kHz
-    IMU_init();                                                  // initialize LSM6DS33 
-    LCD_init();                                                  // initialize LCD/SPI communication
+    i2cRate = i2c_master_setup();                                // set up I2C2 as master, at 400 kHz
+    lsm6ds33_setup();                                            // initialize LSM6DS33:
+    lsm6ds33_accel(LSM6DS33_ODR_1660HZ, LSM6DS33_XL_2G, LSM6DS33_XL_BW_100HZ); // 1.66 kHz, 2 g, 100 Hz LPF
+    lsm6ds33_gyro(LSM6DS33_ODR_1660HZ, LSM6DS33_G_245DPS);      // 1.66 kHz, 245 dps
+    imu_range_setup();                                           // automatic ranges from there, and
+                                                                 // all registers, in burst writes
+    LCD_init_start();                                            // initialize LCD/SPI communication, the
+                                                                 // rest is sent from APP_Tasks
     TRISAbits.TRISA4 = 0;                                        // set up green LED heartbeat check
     LATAbits.LATA4 = 0;   
-    LCD_clearScreen(BLACK);
-    
-    // WHOAMI check
-    char lcd[30];
-    i2c_master_start();
-    i2c_master_send((LSM6DS33 << 1) | 0); // notify via write
-    i2c_master_send(0x0F); // WHOAMI register
-    i2c_master_restart();
-    i2c_master_send((LSM6DS33 << 1) | 1); // master is reading
-    int whoami = (int) i2c_master_recv();
-    i2c_master_ack(1);
-    i2c_master_stop();
-    sprintf(lcd,"WHOAMI = %d",whoami);
-    drawString(10,10,lcd,WHITE,BLACK);
+    tilt_setup();                                                // pointer engine defaults
+    imu_cal_setup();                                             // this board's calibration, if saved
+    attitude_setup();                                            // roll/pitch filter defaults
+    gyro_drift_setup();                                          // nothing learned yet
 }
 
 /******************************************************************************
@@ -250,11 +542,21 @@ void APP_Initialize(void) {
  */
 
 void APP_Tasks(void) {
-    unsigned char imudata[14];           // IMU data array
-    signed short accelX = 0, accelY = 0; // x&y accelerometer data
-    static uint8_t incX = 0, incY = 0;   // scaled accelerometer data
+    uint32_t frame;                      // current USB frame
+    signed char incX, incY;              // pointer motion
+    bool send;
     char lcd[30];                        // for printing to LCD
 
+    // the LCD boots (a few hundred ms of waits) alongside USB and the IMU
+    // rather than before them, and is only drawn on once it's done
+    if (!lcdReady && LCD_init_task()) {
+        LCD_clearScreen(BLACK);
+        sprintf(lcd,"WHOAMI = %d",lsm6ds33_who_am_i());  // IMU check
+        drawString(10,10,lcd,WHITE,BLACK);
+        strip_chart_setup(CHART_TOP, _GRAMHEIGH - CHART_TOP, 3, chartColors);
+        lcdReady = true;
+    }
+
     /* Check the application's current state. */
     switch (appData.state) {
             /* Application's initial state. */
@@ -284,93 +586,119 @@ void APP_Tasks(void) {
              * Device Event Handler */
 
             if (appData.isConfigured) {
+                appData.imuDataValid = false;
+                appData.reportButton[0] = MOUSE_BUTTON_STATE_RELEASED;
+                appData.reportButton[1] = MOUSE_BUTTON_STATE_RELEASED;
+                appData.reportFrame = appData.frameCount;
                 appData.state = APP_STATE_MOUSE_EMULATE;
             }
             break;
 
         case APP_STATE_MOUSE_EMULATE:
-            
-            // get x&y accelerometer data from IMU 
-            i2c_read_multiple(LSM6DS33,0x20,imudata,14); // 0x20 = temp_L register
-            accelX = (imudata[9] << 8) | imudata[8];   
-            accelY = (imudata[11] << 8) | imudata[10];
-            
-            // scale the accelerometer values for the computer screen
-            incX = accelX/200;
-            incY = accelY/200;
-
-            // print data to LCD (as a check)
-            sprintf(lcd,"AX = %d   ",incX);
-            drawString(10,20,lcd,WHITE,BLACK);
-            sprintf(lcd,"AY = %d   ",incY);
-            drawString(10,30,lcd,WHITE,BLACK);
-            
-            // every 50th loop, or 20 times per second (**reverse x&y from IMU**)
-            // send data every other cycle
+
+            // everything runs once per USB frame, right after its SOF, so the report
+            // is queued early in the frame the host polls it in
+            if (!appData.sofEventHasOccurred) {
+                break;
+            }
+            appData.sofEventHasOccurred = false;
+            frame = appData.frameCount;
+
+            // update the attitude with the IMU data read ahead at the end of the last
+            // frame and move the pointer, by the frames since the last update (normally 1)
+            if (appData.imuDataValid) {
+                attitude_update(appData.imu.gyro, appData.imu.accel, (frame - appData.tiltFrame) * 1000UL);
+                tilt_update((frame - appData.tiltFrame) * 1000UL);
+            }
+            appData.tiltFrame = frame;
+
             appData.mouseButton[0] = MOUSE_BUTTON_STATE_RELEASED;
             appData.mouseButton[1] = MOUSE_BUTTON_STATE_RELEASED;
-            i++;
-            if (i == 2) {                        
-                appData.xCoordinate = (int8_t) incY;
-                appData.yCoordinate = (int8_t) -incX;
-                i = 0;
-            } else {
-                appData.xCoordinate = (int8_t) 0;
-                appData.yCoordinate = (int8_t) 0;
-            }  
 
             // Assemble & Send
+            // The pointer motion accumulates in the tilt engine while a report is
+            // still in flight, so waiting for it loses nothing
             if (!appData.isMouseReportSendBusy) {
-                /* This means we can send the mouse report. The
-                   isMouseReportBusy flag is updated in the HID Event Handler. */
-
-                appData.isMouseReportSendBusy = true;
-
-                /* Create the mouse report */
-
-                MOUSE_ReportCreate(appData.xCoordinate, appData.yCoordinate,
-                        appData.mouseButton, &mouseReport);
-
-                if (memcmp((const void *) &mouseReportPrevious, (const void *) &mouseReport,
-                        (size_t)sizeof (mouseReport)) == 0) {
-                    /* Reports are same as previous report. However mouse reports
-                     * can be same as previous report as the coordinate positions are relative.
-                     * In that case it needs to be sent */
-                    if ((appData.xCoordinate == 0) && (appData.yCoordinate == 0)) {
-                        /* If the coordinate positions are 0, that means there
-                         * is no relative change */
-                        if (appData.idleRate == 0) {
-                            appData.isMouseReportSendBusy = false;
-                        } else {
-                            /* Check the idle rate here. If idle rate time elapsed
-                             * then the data will be sent. Idle rate resolution is
-                             * 4 msec as per HID specification; possible range is
-                             * between 4msec >= idlerate <= 1020 msec.
-                             */
-                            if (appData.setIdleTimer
-                                    >= appData.idleRate * 4) {
-                                /* Send REPORT as idle time has elapsed */
-                                appData.isMouseReportSendBusy = true;
-                            } else {
-                                /* Do not send REPORT as idle time has not elapsed */
-                                appData.isMouseReportSendBusy = false;
-                            }
-                        }
-                    }
-                }
-                if (appData.isMouseReportSendBusy == true) {
-                    /* Copy the report sent to previous */
-                    memcpy((void *) &mouseReportPrevious, (const void *) &mouseReport,
-                            (size_t)sizeof (mouseReport));
-
-                    /* Send the mouse report. */
+                tilt_take(&incX, &incY);
+                appData.xCoordinate = (int8_t) incX;
+                appData.yCoordinate = (int8_t) incY;
+
+                // send if anything moved or a button changed, or, with an idle rate
+                // (in 4 ms units, 0 = only on changes), when that long has passed
+                send = incX != 0 || incY != 0
+                        || appData.mouseButton[0] != appData.reportButton[0]
+                        || appData.mouseButton[1] != appData.reportButton[1]
+                        || (appData.idleRate != 0
+                            && frame - appData.reportFrame >= (uint32_t) appData.idleRate * 4);
+
+                if (send) {
+                    /* The isMouseReportBusy flag is updated in the HID Event Handler. */
+                    appData.isMouseReportSendBusy = true;
+                    MOUSE_ReportCreate(appData.xCoordinate, appData.yCoordinate,
+                            appData.mouseButton, &mouseReport);
                     USB_DEVICE_HID_ReportSend(appData.hidInstance,
                             &appData.reportTransferHandle, (uint8_t*) & mouseReport,
                             sizeof (MOUSE_REPORT));
-                    appData.setIdleTimer = 0;
+                    appData.reportFrame = frame;
+                    appData.reportButton[0] = appData.mouseButton[0];
+                    appData.reportButton[1] = appData.mouseButton[1];
+                    sumX += incX;
+                    sumY += incY;
+                    telemX += incX;
+                    telemY += incY;
                 }
             }
-          
+
+            // read the IMU for the next frame now, after the report is on its way
+            // (temperature, gyro and accelerometer), scale it to the same units
+            // whatever range it was read at (switching the range if it needs to),
+            // and correct it: calibration, then the gyro bias's drift with temperature
+            {
+                IMU_SAMPLE *imu = &appData.imu;
+                lsm6ds33_read(LSM6DS33_OUT_TEMP_L, appData.imuData, IMU_READ_LENGTH);
+                imu_range_convert(appData.imuData, imu);
+                if (imu_cal_sample(imu->gyro, imu->accel) && replyLength == 0) {
+                    replyLength = imu_cal_result(reply, sizeof (reply));
+                }
+                imu_cal_apply(imu->gyro, imu->accel);
+                if (!imu_cal_collecting()) {
+                    gyro_drift_update(imu->temperature, imu->gyro, imu->accel);
+                }
+                gyro_drift_apply(imu->gyro);
+                appData.imuDataValid = true;
+            }
+
+            // the chart: one line at a time, scrolled along by the LCD itself
+            if (lcdReady && frame - chartFrame >= CHART_FRAMES) {
+                chartFrame = frame;
+                strip_chart_add(chartGyro ? appData.imu.gyro : appData.imu.accel);
+            }
+
+            // print data to LCD (as a check): counts moved in the last 100 ms, and
+            // the attitude in whole degrees. The lines take several ms to draw, so
+            // they are queued and drawn a few characters per frame, and the next
+            // update waits until the last one is on the screen
+            if (lcdReady && frame - lcdFrame >= LCD_FRAMES && !LCD_textBusy()) {
+                lcdFrame = frame;
+                sprintf(lcd,"DX = %d   ",sumX);
+                LCD_text(10,20,lcd,WHITE,BLACK);
+                sprintf(lcd,"DY = %d   ",sumY);
+                LCD_text(10,30,lcd,WHITE,BLACK);
+                sprintf(lcd,"ROLL = %d   ",attitude_roll() / 100);
+                LCD_text(10,40,lcd,WHITE,BLACK);
+                sprintf(lcd,"PITCH = %d   ",attitude_pitch() / 100);
+                LCD_text(10,50,lcd,WHITE,BLACK);
+                sprintf(lcd,"YAW = %d/s   ",attitude_yaw_rate() / 100);
+                LCD_text(10,60,lcd,WHITE,BLACK);
+                sumX = 0;
+                sumY = 0;
+            }
+            if (lcdReady) {
+                LCD_textTask(LCD_CHARS);
+            }
+
+            // CDC commands and telemetry, after the mouse so they never delay a report
+            APP_CDCTasks(frame);
             break;
 
         case APP_STATE_ERROR:
@@ -386,48 +714,6 @@ void APP_Tasks(void) {
     }
 }
 
-void IMU_init() {
-    // accelerometer init: 1.66 kHz sample rate, 2g sensitivity, 100 Hz anti-aliasing LPF
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x10); // CTRL1_XL register 
-    i2c_master_send(0b10000010);
-    i2c_master_stop();
-    
-    // gyroscope init: 1.66 kHz sample rate, 1000 dps sensitivity
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x11); // CTRL2_G register 
-    i2c_master_send(0b10001000);
-    i2c_master_stop();
-    
-    // CTRL3_C: make IF_INC = 1 to read multiple registers in a row w/o specifying every address
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x12); // CTRL3_C register 
-    i2c_master_send(0b00000100);
-    i2c_master_stop();
-}
-
-void i2c_read_multiple(unsigned char address, unsigned char reg, unsigned char *data, int length) {
-    // set register to read from 
-    i2c_master_start();
-    i2c_master_send((address << 1) | 0); // notify via write
-    i2c_master_send(reg); // 
-    i2c_master_restart();
-    
-    // loop to get all data
-    int i = 0;
-    i2c_master_send((address << 1) | 1); // master is reading
-    for (i = 0; i <= length-1; i++) {
-        data[i] = i2c_master_recv();
-        if (i < length-1) {
-            i2c_master_ack(0);      // not done getting all the data
-        } else {i2c_master_ack(1);} // done getting all data    
-    }
-    i2c_master_stop();
-}
-
 /*******************************************************************************
  End of File
  */
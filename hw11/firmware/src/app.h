@@ -16,7 +16,14 @@
 #include "system_definitions.h"
 #include "mouse.h"
 #include "i2c_master_noint.h"
+#include "lsm6ds33.h"
+#include "tilt.h"
+#include "attitude.h"
+#include "gyro_drift.h"
+#include "imu_cal.h"
+#include "imu_range.h"
 #include "ST7735.h" 
+#include "strip_chart.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -101,8 +108,43 @@ typedef struct
     /* Flag determines SOF event has occured */
     bool sofEventHasOccurred;
 
-    /* SET IDLE timer */
-    uint16_t setIdleTimer;
+    /* USB frames (SOFs, 1 ms apart) since power up, counted in the SOF event */
+    volatile uint32_t frameCount;
+
+    /* Frame the last mouse report was sent in, for the idle rate */
+    uint32_t reportFrame;
+
+    /* Buttons in the last mouse report */
+    MOUSE_BUTTON_STATE reportButton[MOUSE_BUTTON_NUMBERS];
+
+    /* IMU data read ahead for the next frame, calibrated, and the frame of the last tilt update */
+    unsigned char imuData[14];
+    IMU_SAMPLE imu;
+    bool imuDataValid;
+    uint32_t tiltFrame;
+
+    /* CDC line coding and control line state, as set by the host */
+    USB_CDC_LINE_CODING setLineCodingData;
+    USB_CDC_LINE_CODING getLineCodingData;
+    USB_CDC_CONTROL_LINE_STATE controlLineStateData;
+
+    /* CDC break data */
+    uint16_t breakData;
+
+    /* CDC read and write transfer handles */
+    USB_DEVICE_CDC_TRANSFER_HANDLE readTransferHandle;
+    USB_DEVICE_CDC_TRANSFER_HANDLE writeTransferHandle;
+
+    /* True when no CDC read / write is in progress */
+    bool isReadComplete;
+    bool isWriteComplete;
+
+    /* Bytes received by the last CDC read */
+    uint32_t readLength;
+
+    /* Frames between CDC telemetry lines (0 = off), and the frame of the last one */
+    uint32_t telemetryPeriod;
+    uint32_t telemetryFrame;
 
 } APP_DATA;
 
@@ -174,9 +216,6 @@ void APP_Initialize ( void );
 
 void APP_Tasks ( void );
 
-void IMU_init(void);
-void i2c_read_multiple(unsigned char, unsigned char, unsigned char *, int);
-
 #endif /* _APP_H */
 /*******************************************************************************
  End of File
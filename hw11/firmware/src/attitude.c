@@ -0,0 +1,163 @@
+#include "attitude.h"
+#include "imu_range.h"
+
+// Attitude
+// Rotating the board by roll about x and then pitch about y moves gravity
+// to (-sin pitch, sin roll cos pitch, cos roll cos pitch) in the board's
+// axes, so the accelerometer alone gives roll = atan2(ay, az) and
+// pitch = atan2(-ax, sqrt(ay^2 + az^2)). Between those readings the gyro
+// rates are added up (8.75 mdps per unit, see imu_range.h), and 1/2^shift of the
+// difference to the accelerometer angles is corrected every update, which
+// cancels the gyro's drift without letting its noise through.
+// The angles are kept in 1/100 degree << 15, so one gyro unit for 1 ms
+// still adds 28. atan2 and sin are polynomial approximations, good to
+// about 0.1 degree. At 16 g the squares of the accelerometer need 64 bits.
+
+#define ONE_G IMU_ONE_G
+#define HALF_TURN (18000L << 15)    // 180 degrees in angle units
+#define MAX_DT_US 20000UL           // longer gaps (e.g. the LCD) count as this long
+
+ATTITUDE_CONFIG attitudeConfig;
+
+static long roll, pitch;            // 1/100 degree << 15
+static int yawRate;                 // 1/100 degree per second
+static int first;                   // no update yet, start from the accelerometer
+
+void attitude_setup(void) {
+    attitudeConfig.shift = 4;
+    attitudeConfig.gate = 2000;     // about 0.12 g
+    roll = pitch = 0;
+    yawRate = 0;
+    first = 1;
+}
+
+static unsigned long isqrt(unsigned long long v) {
+    unsigned long long r = 0, bit = 1ULL << 62;
+    while (bit > v) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (unsigned long) r;
+}
+
+int attitude_atan2(long y, long x) {
+    long ax = x < 0 ? -x : x, ay = y < 0 ? -y : y;
+    long z, a;
+
+    if (ax == 0 && ay == 0) {
+        return 0;
+    }
+    // atan(z) for z = 0..1 in Q15: z * (45 + (1 - z) * (14.02 + 3.80 z)) degrees
+    z = ax >= ay ? (long) (((long long) ay << 15) / ax) : (long) (((long long) ax << 15) / ay);
+    a = (z * (4500 + (((32768 - z) * (1402 + ((380 * z) >> 15))) >> 15))) >> 15;
+    if (ay > ax) {
+        a = 9000 - a;
+    }
+    if (x < 0) {
+        a = 18000 - a;
+    }
+    return (int) (y < 0 ? -a : a);
+}
+
+int attitude_sin(int angle) {
+    long d, p;
+    int negative = 0;
+
+    // to -180..180, then 0..180 (Bhaskara's approximation)
+    angle %= 36000;
+    if (angle > 18000) {
+        angle -= 36000;
+    } else if (angle < -18000) {
+        angle += 36000;
+    }
+    if (angle < 0) {
+        angle = -angle;
+        negative = 1;
+    }
+    d = angle;
+    p = d * (18000 - d);
+    p = (long) (((long long) 4 * p << 14) / (405000000LL - p));
+    return (int) (negative ? -p : p);
+}
+
+// a - b in angle units, the short way round
+static long difference(long a, long b) {
+    long d = a - b;
+    if (d > HALF_TURN) {
+        d -= 2 * HALF_TURN;
+    } else if (d < -HALF_TURN) {
+        d += 2 * HALF_TURN;
+    }
+    return d;
+}
+
+static long wrap(long a) {
+    return difference(a, 0);
+}
+
+// add rate (gyro units) for dtUs to the angle
+static long turn(long angle, long rate, unsigned long dtUs) {
+    // 8.75 mdps = 0.875 (1/100 degree)/s per unit: 0.875 * 32768 / 1e6 per us
+    return wrap(angle + (long) ((long long) rate * (long) dtUs * 28672 / 1000000));
+}
+
+void attitude_update(const long *gyro, const long *accel, unsigned long dtUs) {
+    unsigned long long ayz2 = (unsigned long long) ((long long) accel[1] * accel[1])
+            + (unsigned long long) ((long long) accel[2] * accel[2]);
+    unsigned long g = isqrt(ayz2 + (unsigned long long) ((long long) accel[0] * accel[0]));
+    long accelRoll = (long) attitude_atan2(accel[1], accel[2]) << 15;
+    long accelPitch = (long) attitude_atan2(-accel[0], (long) isqrt(ayz2)) << 15;
+    int shift = attitudeConfig.shift;
+
+    if (dtUs > MAX_DT_US) {
+        dtUs = MAX_DT_US;
+    }
+    yawRate = (int) (gyro[2] * 7 / 8);
+
+    if (first || shift <= 0) {
+        roll = accelRoll;
+        pitch = accelPitch;
+        first = 0;
+        return;
+    }
+    roll = turn(roll, gyro[0], dtUs);
+    pitch = turn(pitch, gyro[1], dtUs);
+
+    // the accelerometer only shows gravity when nothing else accelerates the board
+    if (attitudeConfig.gate <= 0
+            || (g > ONE_G ? g - ONE_G : ONE_G - g) <= (unsigned long) attitudeConfig.gate) {
+        if (shift > 15) {
+            shift = 15;
+        }
+        roll = wrap(roll + (difference(accelRoll, roll) >> shift));
+        pitch = wrap(pitch + (difference(accelPitch, pitch) >> shift));
+    }
+}
+
+int attitude_roll(void) {
+    return (int) (roll >> 15);
+}
+
+int attitude_pitch(void) {
+    return (int) (pitch >> 15);
+}
+
+int attitude_yaw_rate(void) {
+    return yawRate;
+}
+
+void attitude_gravity(long *g) {
+    int r = attitude_roll(), p = attitude_pitch();
+    long cosPitch = attitude_sin(9000 - p);
+    g[0] = -(long) attitude_sin(p) * ONE_G >> 14;
+    g[1] = (long) ((long long) attitude_sin(r) * cosPitch * ONE_G >> 28);
+    g[2] = (long) ((long long) attitude_sin(9000 - r) * cosPitch * ONE_G >> 28);
+}
@@ -0,0 +1,26 @@
+#ifndef ATTITUDE_H__
+#define ATTITUDE_H__
+// Header file for attitude.c
+// roll and pitch of the board from the LSM6DS33, a complementary filter in
+// fixed point: the gyro carries the angles and the accelerometer pulls them
+// back, but only while it reads close to 1 g, so shaking doesn't tilt them
+
+typedef struct {
+    int shift;      // 1/2^shift of the difference to the accelerometer corrected every update,
+                    // 0: the accelerometer alone (the gyro isn't used)
+    int gate;       // 1/IMU_ONE_G g |a| may differ from 1 g and still correct, 0: no limit
+} ATTITUDE_CONFIG;
+
+extern ATTITUDE_CONFIG attitudeConfig;  // may be changed at any time
+
+void attitude_setup(void);              // load the default configuration, level
+void attitude_update(const long *gyro, const long *accel, unsigned long dtUs); // advance by dtUs
+                                        // with a calibrated sample, gyro and accelerometer x,y,z
+int attitude_roll(void);                // about x, 1/100 degree, -18000 to 18000
+int attitude_pitch(void);               // about y, 1/100 degree
+int attitude_yaw_rate(void);            // about z, 1/100 degree per second
+void attitude_gravity(long *g);         // where 1 g points in the board's x,y,z, 1/IMU_ONE_G g
+int attitude_atan2(long y, long x);     // angle of (x, y), 1/100 degree, -18000 to 18000
+int attitude_sin(int angle);            // sine of 1/100 degree, 16384 = 1
+
+#endif
@@ -0,0 +1,157 @@
+#include "gyro_drift.h"
+#include <stdio.h>
+
+// Gyro drift
+// The board counts as still when, over a window, the accelerometer's
+// variance is tiny on every axis and the gyro shows no real rotation (a
+// steady turn about the vertical doesn't move gravity). The gyro's mean over
+// a still window is then its bias at the window's mean temperature, and is
+// averaged into that temperature's bin: plainly for the first 16 windows,
+// then 1/16 of the way, so it can still follow slow ageing.
+// The bias in use is interpolated between the learned bins either side of
+// the current (smoothed) temperature, or taken from the nearest one if only
+// one side has been learned. Biases are kept in 1/16 of the gyro's units
+// (imu_range.h).
+
+#define STILL_VARIANCE 2500         // accelerometer units^2 per axis, about 3 mg rms
+#define STILL_JUMP 2000             // a sample this far from the window's first is movement
+#define STILL_RATE 1200             // gyro units, about 10 dps
+#define MAX_WEIGHT 16
+
+static short bias[GYRO_DRIFT_BINS][3];      // 1/16 units
+static unsigned char weight[GYRO_DRIFT_BINS]; // windows averaged in, 0: not learned
+static long temperature;                    // smoothed, temperature counts << 6
+static int tracking;                        // temperature has a first reading
+
+static int count;                           // samples in the window
+static long first[3];                       // accelerometer at the start of the window
+static long sum[3], squares[3];             // accelerometer, from first
+static long gyroSum[3];
+static long tempSum;
+static int moved;
+static int still;                           // the last window was still
+
+void gyro_drift_setup(void) {
+    int b, i;
+    for (b = 0; b < GYRO_DRIFT_BINS; b++) {
+        for (i = 0; i < 3; i++) {
+            bias[b][i] = 0;
+        }
+        weight[b] = 0;
+    }
+    tracking = 0;
+    count = 0;
+    still = 0;
+}
+
+static int bin(long temp) {
+    long b = (temp - GYRO_DRIFT_T0) / GYRO_DRIFT_BIN;
+    return b < 0 ? 0 : (b >= GYRO_DRIFT_BINS ? GYRO_DRIFT_BINS - 1 : (int) b);
+}
+
+// a full window: learn from it if the board was still
+static void learn(void) {
+    long g[3];
+    int b, i, n;
+
+    still = !moved;
+    for (i = 0; i < 3 && still; i++) {
+        long variance = (long) ((squares[i] - (long long) sum[i] * sum[i] / GYRO_DRIFT_WINDOW)
+                / GYRO_DRIFT_WINDOW);
+        g[i] = gyroSum[i] * 16 / GYRO_DRIFT_WINDOW;
+        if (variance > STILL_VARIANCE || g[i] > STILL_RATE * 16 || g[i] < -STILL_RATE * 16) {
+            still = 0;
+        }
+    }
+    if (!still) {
+        return;
+    }
+    b = bin(tempSum / GYRO_DRIFT_WINDOW);
+    if (weight[b] < MAX_WEIGHT) {
+        weight[b]++;
+    }
+    n = weight[b];
+    for (i = 0; i < 3; i++) {
+        bias[b][i] += (short) ((g[i] - bias[b][i]) / n);
+    }
+}
+
+void gyro_drift_update(short temp, const long *gyro, const long *accel) {
+    int i;
+
+    // the die warms slowly, the reading jitters by a few counts
+    if (!tracking) {
+        temperature = (long) temp << 6;
+        tracking = 1;
+    }
+    temperature += (((long) temp << 6) - temperature) >> 6;
+
+    if (count == 0) {
+        for (i = 0; i < 3; i++) {
+            first[i] = accel[i];
+            sum[i] = squares[i] = gyroSum[i] = 0;
+        }
+        tempSum = 0;
+        moved = 0;
+    }
+    for (i = 0; i < 3; i++) {
+        long d = accel[i] - first[i];
+        if (d > STILL_JUMP || d < -STILL_JUMP) {
+            moved = 1;
+        } else {
+            sum[i] += d;
+            squares[i] += d * d;
+        }
+        gyroSum[i] += gyro[i];
+    }
+    tempSum += temp;
+    if (++count == GYRO_DRIFT_WINDOW) {
+        learn();
+        count = 0;
+    }
+}
+
+// bias at the current temperature, 1/16 units, 0 if nothing is learned yet
+static long current(int axis) {
+    long t = temperature >> 6;
+    int b = bin(t), below, above;
+
+    for (below = b; below >= 0 && weight[below] == 0; below--) {
+    }
+    for (above = b; above < GYRO_DRIFT_BINS && weight[above] == 0; above++) {
+    }
+    if (below < 0 && above >= GYRO_DRIFT_BINS) {
+        return 0;
+    } else if (below < 0) {
+        return bias[above][axis];
+    } else if (above >= GYRO_DRIFT_BINS || above == below) {
+        return bias[below][axis];
+    } else {
+        // between the bins' middles
+        long t0 = GYRO_DRIFT_T0 + below * GYRO_DRIFT_BIN + GYRO_DRIFT_BIN / 2;
+        long span = (long) (above - below) * GYRO_DRIFT_BIN;
+        long f = t - t0;
+        f = f < 0 ? 0 : (f > span ? span : f);
+        return bias[below][axis] + (bias[above][axis] - bias[below][axis]) * f / span;
+    }
+}
+
+void gyro_drift_apply(long *gyro) {
+    int i;
+    for (i = 0; i < 3; i++) {
+        gyro[i] -= (current(i) + 8) >> 4;
+    }
+}
+
+int gyro_drift_print(char *out, int max) {
+    int b, learned = 0;
+    int len;
+    for (b = 0; b < GYRO_DRIFT_BINS; b++) {
+        learned += weight[b] != 0;
+    }
+    // temperature in 1/10 degree C
+    len = snprintf(out, max, "drift temp %ld bins %d bias %ld %ld %ld still %d\r\n",
+            250 + (temperature >> 6) * 10 / 16, learned,
+            (current(0) + 8) >> 4, (current(1) + 8) >> 4, (current(2) + 8) >> 4, still);
+    return len < max ? len : max - 1;
+}
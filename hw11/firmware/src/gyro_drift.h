@@ -0,0 +1,19 @@
+#ifndef GYRO_DRIFT_H__
+#define GYRO_DRIFT_H__
+// Header file for gyro_drift.c
+// learns what is left of the gyro bias after calibration as a function of
+// the LSM6DS33 die temperature, whenever the board sits still, and takes it
+// off every sample, so the bias follows the board as it warms up
+
+#define GYRO_DRIFT_WINDOW 256       // samples per stillness check, 0.25 s at 1 kHz
+#define GYRO_DRIFT_BIN 32           // temperature counts (16 per degree C) per bin, 2 degrees
+#define GYRO_DRIFT_BINS 40          // bins from GYRO_DRIFT_T0 up, -10 to 70 C
+#define GYRO_DRIFT_T0 (-35 * 16)    // temperature counts at the bottom of the first bin (0 = 25 C)
+
+void gyro_drift_setup(void);        // forget everything learned
+void gyro_drift_update(short temp, const long *gyro, const long *accel); // track the temperature
+                                    // and learn from a calibrated sample (before gyro_drift_apply())
+void gyro_drift_apply(long *gyro);  // take the bias at the current temperature off gyro x,y,z
+int gyro_drift_print(char *out, int max); // temperature, bins learned and bias in use, one line
+
+#endif
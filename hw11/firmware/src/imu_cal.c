@@ -0,0 +1,252 @@
+#include "imu_cal.h"
+#include "imu_range.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xc.h>
+#include <sys/kmem.h>
+
+// IMU calibration
+// Six-position accelerometer calibration: with an axis pointing straight up
+// it reads bias + 1 g, pointing down bias - 1 g, so the two averages give
+// bias = (up + down) / 2 and scale = 2 g / (up - down). Each position is
+// recognised from the averages (one axis near +-1 g, the others near 0), so
+// they can be taken in any order; an axis is updated as soon as it has both.
+// The gyro bias is its average at rest.
+// A sample that moves more than a little while averaging spoils it.
+// The calibration lives in one flash page of its own, which is erased and
+// rewritten by imu_cal_save(). The CPU stalls while the flash is busy
+// (about 20 ms for the erase), so only save when asked to.
+// The page is the last one of program flash, at a fixed address and with no
+// load data, so it isn't part of the hex file, and the project preserves that
+// range when programming: reflashing the firmware keeps the calibration.
+
+#define ONE_G IMU_ONE_G
+#define STILL_ACCEL 1000            // largest spread of an axis while averaging, ~0.06 g
+#define STILL_GYRO 2400             // ~20 dps
+#define PAGE_SIZE 1024              // flash erase page on the PIC32MX1xx/2xx
+#define PAGE_ADDRESS 0x9D01FC00     // last page of the PIC32MX250F128B's 128 KB, kseg0
+#define MAGIC 0x43414C32            // "CAL2", gyro in 8.75 mdps units
+#define WORDS 7                     // magic, IMU_CAL (18 bytes, padded), check
+
+#define NVMOP_WORD_PROGRAM 0x1
+#define NVMOP_PAGE_ERASE 0x4
+
+// the reserved page: noload keeps it out of the hex, so it holds whatever was
+// last saved (or is erased), and it is only ever read through a volatile
+// pointer so the compiler can't assume anything about what is in it
+static const uint32_t page[PAGE_SIZE / 4]
+        __attribute__((address(PAGE_ADDRESS), space(prog), noload));
+
+static const char *axisName = "xyz";
+
+IMU_CAL imuCal;
+
+static int collecting = -1;         // what is being averaged, -1: nothing
+static int count;
+static long sum[6];                 // gyro x,y,z, accelerometer x,y,z
+static long low[6], high[6];
+static long up[3], down[3];         // position averages per axis
+static int faces;                   // bit 2*axis: up taken, bit 2*axis+1: down taken
+static char result[64];
+
+void imu_cal_clear(void) {
+    int i;
+    for (i = 0; i < 3; i++) {
+        imuCal.accelBias[i] = 0;
+        imuCal.accelScale[i] = IMU_CAL_ONE;
+        imuCal.gyroBias[i] = 0;
+    }
+    faces = 0;
+}
+
+// the words stored for cal, with the check word last
+static void pack(const IMU_CAL *cal, uint32_t *w) {
+    int k;
+    memset(w, 0, WORDS * 4);
+    w[0] = MAGIC;
+    memcpy(&w[1], cal, sizeof(IMU_CAL));
+    for (k = 0; k < WORDS - 1; k++) {
+        w[WORDS - 1] += w[k];
+    }
+    w[WORDS - 1] = ~w[WORDS - 1];
+}
+
+void imu_cal_setup(void) {
+    const volatile uint32_t *stored = page;
+    uint32_t w[WORDS];
+    IMU_CAL cal;
+    int k;
+
+    imu_cal_clear();
+    collecting = -1;
+    result[0] = 0;
+    for (k = 0; k < WORDS; k++) {
+        w[k] = stored[k];
+    }
+    memcpy(&cal, &w[1], sizeof(IMU_CAL));
+    pack(&cal, w);
+    for (k = 0; k < WORDS; k++) {
+        if (w[k] != stored[k]) {
+            return;                 // erased, never saved, or from another layout
+        }
+    }
+    imuCal = cal;
+}
+
+static short clamp(long v) {
+    return v > 32767 ? 32767 : (v < -32768 ? -32768 : (short) v);
+}
+
+void imu_cal_apply(long *gyro, long *accel) {
+    int i;
+    for (i = 0; i < 3; i++) {
+        gyro[i] -= imuCal.gyroBias[i];
+        accel[i] = (long) ((long long) (accel[i] - imuCal.accelBias[i]) * imuCal.accelScale[i] / IMU_CAL_ONE);
+    }
+}
+
+void imu_cal_start(int what) {
+    int i;
+    for (i = 0; i < 6; i++) {
+        sum[i] = 0;
+        low[i] = 0x7FFFFFFF;
+        high[i] = -0x7FFFFFFF;
+    }
+    count = 0;
+    collecting = what;
+}
+
+int imu_cal_collecting(void) {
+    return collecting >= 0;
+}
+
+// an average of the board lying on one face
+static void position(const long *a) {
+    int i, axis = 0;
+    for (i = 1; i < 3; i++) {
+        if (labs(a[i]) > labs(a[axis])) {
+            axis = i;
+        }
+    }
+    for (i = 0; i < 3; i++) {
+        if (i == axis ? labs(a[i]) < ONE_G / 2 : labs(a[i]) > ONE_G / 4) {
+            sprintf(result, "cal not level, try again");
+            return;
+        }
+    }
+    if (a[axis] > 0) {
+        up[axis] = a[axis];
+        faces |= 1 << (2 * axis);
+    } else {
+        down[axis] = a[axis];
+        faces |= 2 << (2 * axis);
+    }
+    if (((faces >> (2 * axis)) & 3) == 3 && up[axis] > down[axis]) {
+        imuCal.accelBias[axis] = (short) ((up[axis] + down[axis]) / 2);
+        imuCal.accelScale[axis] = clamp(2L * ONE_G * IMU_CAL_ONE / (up[axis] - down[axis]));
+        sprintf(result, "cal %c%c %ld, %c bias %d scale %d", a[axis] > 0 ? '+' : '-', axisName[axis],
+                a[axis], axisName[axis], imuCal.accelBias[axis], imuCal.accelScale[axis]);
+    } else {
+        sprintf(result, "cal %c%c %ld, now %c%c", a[axis] > 0 ? '+' : '-', axisName[axis],
+                a[axis], a[axis] > 0 ? '-' : '+', axisName[axis]);
+    }
+}
+
+int imu_cal_sample(const long *gyro, const long *accel) {
+    long avg[6];
+    int i;
+
+    if (collecting < 0) {
+        return 0;
+    }
+    for (i = 0; i < 6; i++) {
+        long v = i < 3 ? gyro[i] : accel[i - 3];
+        sum[i] += v;
+        if (v < low[i]) {
+            low[i] = v;
+        }
+        if (v > high[i]) {
+            high[i] = v;
+        }
+        if (high[i] - low[i] > (i < 3 ? STILL_GYRO : STILL_ACCEL)) {
+            sprintf(result, "cal moved, try again");
+            collecting = -1;
+            return 1;
+        }
+    }
+    if (++count < IMU_CAL_SAMPLES) {
+        return 0;
+    }
+
+    for (i = 0; i < 6; i++) {
+        avg[i] = sum[i] / IMU_CAL_SAMPLES;
+    }
+    if (collecting == IMU_CAL_GYRO) {
+        for (i = 0; i < 3; i++) {
+            imuCal.gyroBias[i] = clamp(avg[i]);
+        }
+        sprintf(result, "cal gyro bias %d %d %d", imuCal.gyroBias[0], imuCal.gyroBias[1],
+                imuCal.gyroBias[2]);
+    } else {
+        position(&avg[3]);
+    }
+    collecting = -1;
+    return 1;
+}
+
+int imu_cal_result(char *out, int max) {
+    int len = snprintf(out, max, "%s\r\n", result);
+    return len < max ? len : max - 1;
+}
+
+int imu_cal_print(char *out, int max) {
+    int len = snprintf(out, max, "cal bias %d %d %d scale %d %d %d gyro %d %d %d\r\n",
+            imuCal.accelBias[0], imuCal.accelBias[1], imuCal.accelBias[2],
+            imuCal.accelScale[0], imuCal.accelScale[1], imuCal.accelScale[2],
+            imuCal.gyroBias[0], imuCal.gyroBias[1], imuCal.gyroBias[2]);
+    return len < max ? len : max - 1;
+}
+
+// run one flash operation at NVMADDR, returns 0 if it failed
+static int nvm(unsigned int op) {
+    unsigned int status, start;
+
+    NVMCON = _NVMCON_WREN_MASK | op;
+    start = _CP0_GET_COUNT();
+    while (_CP0_GET_COUNT() - start < 24 * 7) {
+        // the low voltage detect needs 6 us to start
+    }
+    status = __builtin_disable_interrupts();
+    NVMKEY = 0xAA996655;
+    NVMKEY = 0x556699AA;
+    NVMCONSET = _NVMCON_WR_MASK;
+    if (status & 1) {
+        __builtin_enable_interrupts();
+    }
+    while (NVMCON & _NVMCON_WR_MASK) {
+    }
+    NVMCONCLR = _NVMCON_WREN_MASK;
+    return (NVMCON & (_NVMCON_WRERR_MASK | _NVMCON_LVDERR_MASK)) == 0;
+}
+
+int imu_cal_save(void) {
+    const volatile uint32_t *stored = page;
+    uint32_t w[WORDS];
+    int k;
+
+    pack(&imuCal, w);
+    NVMADDR = KVA_TO_PA(page);
+    if (!nvm(NVMOP_PAGE_ERASE)) {
+        return 0;
+    }
+    for (k = 0; k < WORDS; k++) {
+        NVMADDR = KVA_TO_PA(&page[k]);
+        NVMDATA = w[k];
+        if (!nvm(NVMOP_WORD_PROGRAM) || stored[k] != w[k]) {
+            return 0;
+        }
+    }
+    return 1;
+}
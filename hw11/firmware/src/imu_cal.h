@@ -0,0 +1,38 @@
+#ifndef IMU_CAL_H__
+#define IMU_CAL_H__
+// Header file for imu_cal.c
+// per-board LSM6DS33 calibration: accelerometer bias and scale from six
+// positions, gyro bias at rest, kept in a reserved page of program flash and
+// applied to every sample in integers, in the units of imu_range.h whatever
+// range the sample was taken at
+// The page (the last of program flash) isn't in the hex file and is preserved
+// by the programmer, so a saved calibration survives reflashing the firmware;
+// imu_cal_clear() followed by imu_cal_save() gets rid of it.
+
+#define IMU_CAL_ONE 16384           // accelScale that leaves an axis as it is
+#define IMU_CAL_SAMPLES 512         // samples averaged per position, 0.5 s at 1 kHz
+
+// what imu_cal_start() collects
+#define IMU_CAL_GYRO 0              // gyro bias, board still in any position
+#define IMU_CAL_POSITION 1          // one of the six faces, board still with one axis up or down
+
+typedef struct {
+    short accelBias[3];     // 1/IMU_ONE_G g subtracted from accelerometer x, y, z
+    short accelScale[3];    // and the rest multiplied by accelScale / IMU_CAL_ONE
+    short gyroBias[3];      // IMU_GYRO_MDPS_100 units subtracted from gyro x, y, z
+} IMU_CAL;
+
+extern IMU_CAL imuCal;      // in use, may be changed at any time
+
+void imu_cal_setup(void);               // load the stored calibration, or none if there isn't one
+void imu_cal_apply(long *gyro, long *accel); // correct gyro x,y,z and accelerometer x,y,z in place
+void imu_cal_start(int what);           // start averaging IMU_CAL_GYRO or IMU_CAL_POSITION
+int imu_cal_collecting(void);           // 1 while averaging, feed it with gyro and accelerometer
+int imu_cal_sample(const long *gyro, const long *accel); // feed a raw sample, returns 1 when
+                                        // the average is done and imu_cal_result() has the outcome
+int imu_cal_result(char *out, int max); // what the last average did, one line
+int imu_cal_print(char *out, int max);  // the calibration in use, one line
+void imu_cal_clear(void);               // back to no correction (not stored until imu_cal_save())
+int imu_cal_save(void);                 // write imuCal to flash, returns 0 if that failed
+
+#endif
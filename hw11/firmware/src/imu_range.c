@@ -0,0 +1,146 @@
+#include "imu_range.h"
+#include <stdio.h>
+
+// IMU ranges
+// The sensitivities of both sensors double from one range to the next
+// (0.061, 0.122, 0.244, 0.488 mg and 8.75, 17.5, 35, 70 mdps per count), so
+// a count is converted by shifting it up by the range's step, and every
+// sample comes out in the finest range's units, whatever it was read at.
+// In automatic mode a reading past UP of the range switches straight to the
+// widest range, so a knock is caught within a sample or two, and the range
+// steps back down one at a time once every reading has stayed under DOWN
+// for HOLD samples. DOWN is below half of UP, so the lower range starts
+// clear of switching back up.
+// The chip applies a new range from its next output sample, so the reads
+// in between could be in either; the last good sample is repeated for
+// SETTLE reads instead.
+
+#define UP 29500                    // counts, 90% of full scale
+#define DOWN 13000                  // 40%
+#define HOLD 500                    // samples, 0.5 s at 1 kHz
+#define SETTLE 2                    // reads, the chip runs at 1.66 kHz
+#define CLIP 32700
+
+#define FS_MASK 0x0C                // FS_XL / FS_G in CTRL1_XL / CTRL2_G
+
+// by step, finest first
+static const LSM6DS33_XL_FS accelFs[4] = {LSM6DS33_XL_2G, LSM6DS33_XL_4G, LSM6DS33_XL_8G, LSM6DS33_XL_16G};
+static const int accelG[4] = {2, 4, 8, 16};
+static const LSM6DS33_G_FS gyroFs[4] = {LSM6DS33_G_245DPS, LSM6DS33_G_500DPS, LSM6DS33_G_1000DPS, LSM6DS33_G_2000DPS};
+static const int gyroDps[4] = {245, 500, 1000, 2000};
+
+IMU_RANGE_CONFIG imuRangeConfig;
+
+typedef struct {
+    int step;                       // 0 to 3
+    int quiet;                      // samples all under DOWN
+} range_t;
+
+static range_t accel, gyro;
+static int settle;
+static IMU_SAMPLE last;
+
+// write the ranges to the chip, in one burst if both changed
+static void program(void) {
+    lsm6ds33_set_bits(LSM6DS33_CTRL1_XL, FS_MASK, accelFs[accel.step] << 2);
+    lsm6ds33_set_bits(LSM6DS33_CTRL2_G, FS_MASK, gyroFs[gyro.step] << 2);
+    if (lsm6ds33_flush() > 0) {
+        settle = SETTLE;
+    }
+}
+
+static int find(const int *list, int value) {
+    int k;
+    for (k = 0; k < 4; k++) {
+        if (list[k] == value) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+int imu_range_set(int g, int dps) {
+    int a = g == 0 ? 0 : find(accelG, g), r = dps == 0 ? 0 : find(gyroDps, dps);
+    if (a < 0 || r < 0) {
+        return 0;
+    }
+    imuRangeConfig.accelG = g;
+    imuRangeConfig.gyroDps = dps;
+    accel.step = a;
+    gyro.step = r;
+    accel.quiet = gyro.quiet = 0;
+    program();
+    return 1;
+}
+
+void imu_range_setup(void) {
+    imu_range_set(0, 0);
+    settle = 0;                     // nothing read before to hold on to
+}
+
+// the step a sensor should be at after a sample with this peak count
+static int next(range_t *r, int automatic, int peak) {
+    if (!automatic) {
+        return r->step;
+    }
+    if (peak >= UP) {
+        r->quiet = 0;
+        return 3;
+    }
+    if (peak >= DOWN || r->step == 0) {
+        r->quiet = 0;
+        return r->step;
+    }
+    if (++r->quiet < HOLD) {
+        return r->step;
+    }
+    r->quiet = 0;
+    return r->step - 1;
+}
+
+int imu_range_convert(const unsigned char *imudata, IMU_SAMPLE *sample) {
+    short raw[6];
+    int i, peakG = 0, peakA = 0, a, g;
+
+    sample->temperature = (imudata[1] << 8) | imudata[0];
+    for (i = 0; i < 6; i++) {
+        raw[i] = (imudata[2 * i + 3] << 8) | imudata[2 * i + 2];
+    }
+    if (settle > 0) {
+        // maybe still the old range, keep the last sample
+        settle--;
+        last.temperature = sample->temperature;
+        *sample = last;
+        return 0;
+    }
+
+    sample->clipped = 0;
+    for (i = 0; i < 3; i++) {
+        int vg = raw[i] < 0 ? -raw[i] : raw[i], va = raw[i + 3] < 0 ? -raw[i + 3] : raw[i + 3];
+        peakG = vg > peakG ? vg : peakG;
+        peakA = va > peakA ? va : peakA;
+        sample->gyro[i] = (long) raw[i] << gyro.step;
+        sample->accel[i] = (long) raw[i + 3] << accel.step;
+    }
+    sample->clipped = peakG >= CLIP || peakA >= CLIP;
+    sample->gyroRange = gyroFs[gyro.step];
+    sample->accelRange = accelFs[accel.step];
+    last = *sample;
+
+    a = next(&accel, imuRangeConfig.accelG == 0, peakA);
+    g = next(&gyro, imuRangeConfig.gyroDps == 0, peakG);
+    if (a == accel.step && g == gyro.step) {
+        return 0;
+    }
+    accel.step = a;
+    gyro.step = g;
+    program();
+    return 1;
+}
+
+int imu_range_print(char *out, int max) {
+    int len = snprintf(out, max, "range %dg %s %ddps %s\r\n",
+            accelG[accel.step], imuRangeConfig.accelG == 0 ? "auto" : "fixed",
+            gyroDps[gyro.step], imuRangeConfig.gyroDps == 0 ? "auto" : "fixed");
+    return len < max ? len : max - 1;
+}
@@ -0,0 +1,35 @@
+#ifndef IMU_RANGE_H__
+#define IMU_RANGE_H__
+// Header file for imu_range.c
+// full scale of the LSM6DS33's accelerometer and gyro, fixed or switched
+// automatically as the readings near the end of the range, and samples
+// converted to the same units whatever range they were taken at
+
+#include "lsm6ds33.h"
+
+#define IMU_ONE_G 16384             // accelerometer units per g (0.061 mg, the 2 g range's count)
+#define IMU_GYRO_MDPS_100 875       // gyro units, 1/100 mdps each (the 245 dps range's count)
+
+typedef struct {
+    short temperature;              // 16 per degree C, 0 = 25 C
+    long gyro[3];                   // x,y,z in IMU_GYRO_MDPS_100 units
+    long accel[3];                  // x,y,z in 1/IMU_ONE_G g
+    LSM6DS33_G_FS gyroRange;        // the ranges the sample was taken at
+    LSM6DS33_XL_FS accelRange;
+    unsigned char clipped;          // a reading was at the end of its range
+} IMU_SAMPLE;
+
+typedef struct {
+    int accelG;     // 2, 4, 8 or 16, 0: automatic
+    int gyroDps;    // 245, 500, 1000 or 2000, 0: automatic
+} IMU_RANGE_CONFIG;
+
+extern IMU_RANGE_CONFIG imuRangeConfig;     // change with imu_range_set()
+
+void imu_range_setup(void);         // automatic ranges, starting at the finest; writes the chip
+int imu_range_set(int accelG, int gyroDps); // as in IMU_RANGE_CONFIG, returns 0 if not a range
+int imu_range_convert(const unsigned char *imudata, IMU_SAMPLE *sample); // a 14 byte read from
+                                    // OUT_TEMP_L into a sample, returns 1 if it changed a range
+int imu_range_print(char *out, int max); // the ranges in use, one line
+
+#endif
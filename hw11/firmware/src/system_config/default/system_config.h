@@ -121,8 +121,8 @@ extern "C" {
 #define DRV_USBFS_INTERRUPT_MODE      true
 
 
-    /* Number of Endpoints used */
-#define DRV_USBFS_ENDPOINTS_NUMBER    2
+    /* Number of Endpoints used: EP0, EP1 HID mouse, EP2 CDC notification, EP3 CDC data */
+#define DRV_USBFS_ENDPOINTS_NUMBER    4
 
 
 
@@ -174,6 +174,14 @@ extern "C" {
        function driver */
 #define USB_DEVICE_HID_QUEUE_DEPTH_COMBINED 2
 
+    /* Maximum instances of CDC function driver */
+#define USB_DEVICE_CDC_INSTANCES_NUMBER     1
+
+    /* CDC Transfer Queue Size for read, write and serial state
+       notification, kept apart from the HID queue so telemetry
+       can't hold up a mouse report */
+#define USB_DEVICE_CDC_QUEUE_DEPTH_COMBINED 3
+
 
 
 
@@ -190,6 +198,10 @@ extern "C" {
     /* Macro defines USB internal DMA Buffer criteria*/
 #define APP_MAKE_BUFFER_DMA_READY
 
+    /* Application USB Device CDC Read Buffer Size. This should be a multiple of
+     * the CDC Bulk Endpoint size */
+#define APP_READ_BUFFER_SIZE 64
+
     //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
@@ -56,6 +56,7 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 #include "driver/usb/usbfs/drv_usbfs.h"
 #include "usb/usb_device.h"
 #include "usb/usb_device_hid.h"
+#include "usb/usb_device_cdc.h"
 #include "app.h"
 
 
@@ -201,11 +201,18 @@ const uint8_t hid_rpt0[] =
         .queueSizeReportReceive = 1,
         .queueSizeReportSend = 1
     };
+
+    const USB_DEVICE_CDC_INIT cdcInit0 =
+    {
+        .queueSizeRead = 1,
+        .queueSizeWrite = 1,
+        .queueSizeSerialStateNotification = 1
+    };
 /**************************************************
  * USB Device Layer Function Driver Registration 
  * Table
  **************************************************/
-const USB_DEVICE_FUNCTION_REGISTRATION_TABLE funcRegistrationTable[1] =
+const USB_DEVICE_FUNCTION_REGISTRATION_TABLE funcRegistrationTable[2] =
 {
     /* Function 1 */
     { 
@@ -217,6 +224,16 @@ const USB_DEVICE_FUNCTION_REGISTRATION_TABLE funcRegistrationTable[1] =
         .driver = (void*)USB_DEVICE_HID_FUNCTION_DRIVER,    /* USB HID function data exposed to device layer */
         .funcDriverInit = (void*)&hidInit0,    /* Function driver init data*/
     },
+    /* Function 2 */
+    { 
+        .configurationValue = 1,    /* Configuration value */ 
+        .interfaceNumber = 1,       /* First interfaceNumber of this function */ 
+        .speed = USB_SPEED_FULL,    /* Function Speed */ 
+        .numberOfInterfaces = 2,    /* Number of interfaces */
+        .funcDriverIndex = 0,  /* Index of CDC Function Driver */
+        .driver = (void*)USB_DEVICE_CDC_FUNCTION_DRIVER,    /* USB CDC function data exposed to device layer */
+        .funcDriverInit = (void*)&cdcInit0    /* Function driver init data */
+    },
 };
 
 /*******************************************
@@ -230,12 +247,13 @@ const USB_DEVICE_DESCRIPTOR deviceDescriptor =
     0x12,                           // Size of this descriptor in bytes
     USB_DESCRIPTOR_DEVICE,          // DEVICE descriptor type
     0x0200,                         // USB Spec Release Number in BCD format
-    0x00,                           // Class Code
-    0x00,                           // Subclass code
-    0x00,                           // Protocol code
+    0xEF,                           // Class Code (Miscellaneous, functions use IADs)
+    0x02,                           // Subclass code (Common Class)
+    0x01,                           // Protocol code (Interface Association Descriptor)
     USB_DEVICE_EP0_BUFFER_SIZE,     // Max packet size for EP0, see system_config.h
     0x04D8,                         // Vendor ID
-    0x0000,                         // Product ID
+    0x0001,                         // Product ID (composite: not the CDC-only boards' 0x000A,
+                                    // so hosts don't reuse a cached single function binding)
     0x0100,                         // Device release number in BCD format
     0x01,                           // Manufacturer string index
     0x02,                           // Product string index
@@ -253,8 +271,8 @@ const uint8_t fullSpeedConfigurationDescriptor[]=
 
     0x09,                                               // Size of this descriptor in bytes
     USB_DESCRIPTOR_CONFIGURATION,                       // Descriptor Type
-    41,0,                //(41 Bytes)Size of the Config descriptor.e
-    1,                                               // Number of interfaces in this cfg
+    107,0,                //(107 Bytes)Size of the Config descriptor.e
+    3,                                               // Number of interfaces in this cfg
     0x01,                                               // Index value of this configuration
     0x00,                                               // Configuration string index
     USB_ATTRIBUTE_DEFAULT | USB_ATTRIBUTE_SELF_POWERED, // Attributes
@@ -300,10 +318,87 @@ const uint8_t fullSpeedConfigurationDescriptor[]=
     USB_TRANSFER_TYPE_INTERRUPT,    // Attributes
     0x40,0x00,                      // size
     0x01,                           // Interval
-    
-    
 
+    /* Descriptor for Function 2 - CDC     */ 
+
+    /* Interface Association Descriptor: groups the two CDC interfaces */
+    0x08,                                           // Size of this descriptor in bytes
+    USB_DESCRIPTOR_INTERFACE_ASSOCIATION,           // Descriptor Type
+    1,                                              // First interface number of this function
+    2,                                              // Number of interfaces
+    USB_CDC_COMMUNICATIONS_INTERFACE_CLASS_CODE,    // Class code
+    USB_CDC_SUBCLASS_ABSTRACT_CONTROL_MODEL,        // Subclass code
+    USB_CDC_PROTOCOL_AT_V250,                       // Protocol code
+    0x00,                                           // Function string index
+
+    /* Interface Descriptor */
+    0x09,                                           // Size of this descriptor in bytes
+    USB_DESCRIPTOR_INTERFACE,                       // Descriptor Type
+    1,                                  // Interface Number
+    0x00,                                           // Alternate Setting Number
+    0x01,                                           // Number of endpoints in this interface
+    USB_CDC_COMMUNICATIONS_INTERFACE_CLASS_CODE,    // Class code
+    USB_CDC_SUBCLASS_ABSTRACT_CONTROL_MODEL,        // Subclass code
+    USB_CDC_PROTOCOL_AT_V250,                       // Protocol code
+    0x00,                                           // Interface string index
+
+    /* CDC Class-Specific Descriptors */
+    sizeof(USB_CDC_HEADER_FUNCTIONAL_DESCRIPTOR),               // Size of the descriptor
+    USB_CDC_DESC_CS_INTERFACE,                                  // CS_INTERFACE
+    USB_CDC_FUNCTIONAL_HEADER,                                  // Type of functional descriptor
+    0x20,0x01,                                                  // CDC spec version
+
+    sizeof(USB_CDC_ACM_FUNCTIONAL_DESCRIPTOR),                  // Size of the descriptor
+    USB_CDC_DESC_CS_INTERFACE,                                  // CS_INTERFACE
+    USB_CDC_FUNCTIONAL_ABSTRACT_CONTROL_MANAGEMENT,             // Type of functional descriptor
+    USB_CDC_ACM_SUPPORT_LINE_CODING_LINE_STATE_AND_NOTIFICATION,// bmCapabilities of ACM
+
+    sizeof(USB_CDC_UNION_FUNCTIONAL_DESCRIPTOR_HEADER) + 1,     // Size of the descriptor
+    USB_CDC_DESC_CS_INTERFACE,                                  // CS_INTERFACE
+    USB_CDC_FUNCTIONAL_UNION,                                   // Type of functional descriptor
+    1,                                                       // com interface number
+    2,
+
+    sizeof(USB_CDC_CALL_MANAGEMENT_DESCRIPTOR),                 // Size of the descriptor
+    USB_CDC_DESC_CS_INTERFACE,                                  // CS_INTERFACE
+    USB_CDC_FUNCTIONAL_CALL_MANAGEMENT,                         // Type of functional descriptor
+    0x00,                                                       // bmCapabilities of CallManagement
+    2,                                                       // Data interface number
+
+    /* Interrupt Endpoint (IN) Descriptor */
+    0x07,                           // Size of this descriptor
+    USB_DESCRIPTOR_ENDPOINT,        // Endpoint Descriptor
+    2 | USB_EP_DIRECTION_IN,    // EndpointAddress ( EP2 IN INTERRUPT)
+    USB_TRANSFER_TYPE_INTERRUPT,    // Attributes type of EP (INTERRUPT)
+    0x10,0x00,                      // Max packet size of this EP
+    0x02,                           // Interval (in ms)
 
+    /* Interface Descriptor */
+    0x09,                               // Size of this descriptor in bytes
+    USB_DESCRIPTOR_INTERFACE,           // INTERFACE descriptor type
+    2,      // Interface Number
+    0x00,                               // Alternate Setting Number
+    0x02,                               // Number of endpoints in this interface
+    USB_CDC_DATA_INTERFACE_CLASS_CODE,  // Class code
+    0x00,                               // Subclass code
+    USB_CDC_PROTOCOL_NO_CLASS_SPECIFIC, // Protocol code
+    0x00,                               // Interface string index
+
+    /* Bulk Endpoint (OUT) Descriptor */
+    0x07,                       // Size of this descriptor
+    USB_DESCRIPTOR_ENDPOINT,    // Endpoint Descriptor
+    3 | USB_EP_DIRECTION_OUT,   // EndpointAddress ( EP3 OUT )
+    USB_TRANSFER_TYPE_BULK,     // Attributes type of EP (BULK)
+    0x40,0x00,                  // Max packet size of this EP
+    0x00,                       // Interval (in ms)
+
+    /* Bulk Endpoint (IN)Descriptor */
+    0x07,                       // Size of this descriptor
+    USB_DESCRIPTOR_ENDPOINT,    // Endpoint Descriptor
+    3 | USB_EP_DIRECTION_IN,    // EndpointAddress ( EP3 IN )
+    USB_TRANSFER_TYPE_BULK,     // Attributes type of EP (BULK)
+    0x40,0x00,                  // Max packet size of this EP
+    0x00,                       // Interval (in ms)
 };
 
 /*******************************************
@@ -405,7 +500,7 @@ const USB_DEVICE_INIT usbDevInitData =
     
     /* Number of function drivers registered to this instance of the
        USB device layer */
-    .registeredFuncCount = 1,
+    .registeredFuncCount = 2,
     
     /* Function driver table registered to this instance of the USB device layer*/
     .registeredFunctions = (USB_DEVICE_FUNCTION_REGISTRATION_TABLE*)funcRegistrationTable,
@@ -0,0 +1,84 @@
+#include "tilt.h"
+#include "attitude.h"
+#include "imu_range.h"
+
+// Tilt to pointer motion
+// Pointer x follows the accelerometer's y axis and pointer y its -x axis.
+// The speed is a curve of the tilt past the dead zone, and the distance
+// moved (speed * time) goes into a residual kept in 1/65536 counts, so a
+// tilt worth a tenth of a count per report moves the pointer one count
+// every ten reports instead of never.
+// The tilt is where the attitude estimate puts gravity, in accelerometer
+// counts, so it is carried by the gyro, which doesn't see the hand's
+// shaking, and only pulled towards the accelerometer.
+
+#define ONE_G IMU_ONE_G         // accelerometer counts at 2 g full scale
+#define MAX_RESIDUAL (4L * 127 << 16) // motion held back while the host isn't taking reports
+#define MAX_DT_US 20000UL       // longer gaps (e.g. the LCD) don't turn into jumps
+
+TILT_CONFIG tiltConfig;
+
+static long long residual[2];   // distance not yet sent, 1/65536 counts
+
+void tilt_setup(void) {
+    tiltConfig.deadZone = 300;  // about 1 degree
+    tiltConfig.gain = 3000;     // 5 degrees: ~50 counts/s
+    tiltConfig.accel = 5500;    // 90 degrees: ~2000 counts/s
+    residual[0] = residual[1] = 0;
+}
+
+// pointer speed for a tilt, 1/65536 counts per ms
+static long speed(long t) {
+    long v = (t < 0 ? -t : t) - tiltConfig.deadZone;
+    if (v <= 0) {
+        return 0;
+    }
+    if (v > ONE_G) {
+        v = ONE_G;
+    }
+    long long g = tiltConfig.gain + (long long) tiltConfig.accel * v / ONE_G;
+    return (long) (g * v / 1024);
+}
+
+static void axis(int a, long t, unsigned long dtUs) {
+    long s = speed(t);
+    if (s == 0) {
+        residual[a] = 0;      // stop dead inside the dead zone
+        return;
+    }
+    long long d = (long long) s * (long) dtUs / 1000;
+    residual[a] += t < 0 ? -d : d;
+    if (residual[a] > MAX_RESIDUAL) {
+        residual[a] = MAX_RESIDUAL;
+    } else if (residual[a] < -MAX_RESIDUAL) {
+        residual[a] = -MAX_RESIDUAL;
+    }
+}
+
+void tilt_update(unsigned long dtUs) {
+    long g[3];
+    if (dtUs > MAX_DT_US) {
+        dtUs = MAX_DT_US;
+    }
+    attitude_gravity(g);
+
+    // tilting about x raises y, tilting about y lowers x
+    axis(0, g[1], dtUs);
+    axis(1, -g[0], dtUs);
+}
+
+static signed char take(int a) {
+    long n = (long) (residual[a] / 65536);  // whole counts, towards zero
+    if (n > 127) {
+        n = 127;
+    } else if (n < -127) {
+        n = -127;
+    }
+    residual[a] -= (long long) n * 65536;
+    return (signed char) n;
+}
+
+void tilt_take(signed char *x, signed char *y) {
+    *x = take(0);
+    *y = take(1);
+}
@@ -0,0 +1,24 @@
+#ifndef TILT_H__
+#define TILT_H__
+// Header file for tilt.c
+// turns the tilt of the board (from attitude.c) into mouse motion: dead zone
+// and acceleration curve, keeping the fraction of a count that didn't fit in
+// one report for the next one so slow tilts still move
+
+typedef struct {
+    int deadZone;   // accelerometer counts (0.061 mg) around level that don't move the pointer
+    int gain;       // linear speed, 1/65536 counts per ms for every 1024 counts past the dead zone
+    int accel;      // acceleration curve: gain added in proportion to the tilt, reaching accel at 1 g
+} TILT_CONFIG;
+
+#define TILT_MAX_DEAD_ZONE 16384 // 1 g: no tilt moves the pointer
+#define TILT_MAX_GAIN 65535      // 1 g at gain and accel both this: ~32000 counts/s
+
+extern TILT_CONFIG tiltConfig;   // may be changed at any time
+
+void tilt_setup(void);                 // load the default configuration, clear the state
+void tilt_update(unsigned long dtUs);  // advance by dtUs, after attitude_update()
+void tilt_take(signed char *x, signed char *y); // whole counts moved since the last take,
+                                                // the rest is kept for the next one
+
+#endif
@@ -5,8 +5,8 @@ import android.support.v7.app.AppCompatActivity;
 import android.os.Bundle;
 import android.Manifest;
 import android.content.pm.PackageManager;
-import android.graphics.Bitmap;
 import android.graphics.Canvas;
+import android.graphics.Color;
 import android.graphics.Paint;
 import android.graphics.SurfaceTexture;
 import android.hardware.Camera;
@@ -21,25 +21,26 @@ import android.widget.SeekBar;
 
 import java.io.IOException;
 
-import static android.graphics.Color.blue;
-import static android.graphics.Color.green;
-import static android.graphics.Color.red;
-import static android.graphics.Color.rgb;
 
-
-public class MainActivity extends AppCompatActivity implements TextureView.SurfaceTextureListener {
+public class MainActivity extends AppCompatActivity
+        implements TextureView.SurfaceTextureListener, Camera.PreviewCallback {
     private Camera mCamera;
     private TextureView mTextureView;
     private SurfaceView mSurfaceView;
     private SurfaceHolder mSurfaceHolder;
-    private Bitmap bmp = Bitmap.createBitmap(640, 480, Bitmap.Config.ARGB_8888);
-    private Canvas canvas = new Canvas(bmp);
     private Paint paint1 = new Paint();
+    private Paint paintGreen = new Paint();
     private TextView mTextView;
     SeekBar myControl;        // for slide-bar sensitivity
 
     static long prevtime = 0; // for FPS calculation
 
+    // preview frame size; the camera delivers landscape NV21 frames (Y plane, then interleaved V,U
+    // at half resolution) and the 640x480 px views show them rotated to portrait and stretched
+    private static final int FRAME_W = 640;
+    private static final int FRAME_H = 480;
+    private float[] points = new float[2 * 640 * 60]; // highlighted pixels, x,y pairs
+
     protected void onCreate(Bundle savedInstanceState) {
         super.onCreate(savedInstanceState);
         setContentView(R.layout.activity_main);
@@ -60,6 +61,7 @@ public class MainActivity extends AppCompatActivity implements TextureView.Surfa
             // set the paintbrush for writing text on the image
             paint1.setColor(0xffff0000);  // red
             paint1.setTextSize(24);
+            paintGreen.setColor(0xff00ff00);  // pure green
 
             mTextView.setText("started camera");
         } else {
@@ -76,6 +78,13 @@ public class MainActivity extends AppCompatActivity implements TextureView.Surfa
         mCamera.setParameters(parameters);
         mCamera.setDisplayOrientation(90); // rotate to portrait mode
 
+        // analyze the NV21 preview frames directly instead of reading back the displayed texture;
+        // two buffers so the camera can fill one while the other is being processed
+        int frameBytes = FRAME_W * FRAME_H * 3 / 2;
+        mCamera.addCallbackBuffer(new byte[frameBytes]);
+        mCamera.addCallbackBuffer(new byte[frameBytes]);
+        mCamera.setPreviewCallbackWithBuffer(this);
+
         try {
             mCamera.setPreviewTexture(surface);
             mCamera.startPreview();
@@ -89,48 +98,59 @@ public class MainActivity extends AppCompatActivity implements TextureView.Surfa
     }
 
     public boolean onSurfaceTextureDestroyed(SurfaceTexture surface) {
+        mCamera.setPreviewCallbackWithBuffer(null);
         mCamera.stopPreview();
         mCamera.release();
         return true;
     }
 
-    // the important function
     public void onSurfaceTextureUpdated(SurfaceTexture surface) {
-        // every time there is a new Camera preview frame
-        mTextureView.getBitmap(bmp);
+        // the preview is only displayed, the frames are analyzed in onPreviewFrame
+    }
 
-        final Canvas c = mSurfaceHolder.lockCanvas();
-        if (c != null) {
-            int thresh = myControl.getProgress(); // comparison threshold, determined by slider bar
-            int[] pixels = new int[bmp.getWidth()]; // pixels[] is the RGBA data
-
-            // nested for loops for the image - looking at every 5th row
-            for (int startY = 100; startY < 400; startY += 5) {
-                // get pixel data from the row
-                bmp.getPixels(pixels, 0, bmp.getWidth(), 0, startY, bmp.getWidth(), 1);
-                for (int i = 0; i < bmp.getWidth(); i++) {
-                    if ((green(pixels[i]) - red(pixels[i])) > thresh) {
-                        pixels[i] = rgb(0, 255, 0); // overwrite the pixel with pure green
-                    }
-                    // update the row
-                    bmp.setPixels(pixels, 0, bmp.getWidth(), 0, startY, bmp.getWidth(), 1);
+    // the important function
+    public void onPreviewFrame(byte[] data, Camera camera) {
+        // every time there is a new Camera preview frame
+        int thresh = myControl.getProgress(); // comparison threshold, determined by slider bar
+        int n = 0;
+
+        // nested for loops for the image - looking at every 5th row of the view
+        // green - red = -0.344 Cb - 2.116 Cr, so only the V (Cr) plane is read and the Cb term is dropped
+        for (int startY = 100; startY < 400; startY += 5) {
+            // a view row is a column of the landscape frame
+            int xs = startY * FRAME_W / FRAME_H;
+            int v = FRAME_W * FRAME_H + (xs & ~1);
+            for (int i = 0; i < 640; i++) {
+                int ys = FRAME_H - 1 - i * FRAME_H / 640;
+                int cr = (data[v + (ys >> 1) * FRAME_W] & 0xFF) - 128;
+                if (-(cr * 17) / 8 > thresh) {
+                    points[n++] = i; // mark the pixel pure green
+                    points[n++] = startY;
                 }
             }
         }
+        camera.addCallbackBuffer(data); // hand the buffer back for the next frame
 
-        // draw a circle at some position
-        int pos = 50;
-        canvas.drawCircle(pos, 240, 5, paint1); // x position, y position, diameter, color
+        final Canvas c = mSurfaceHolder.lockCanvas();
+        if (c != null) {
+            c.drawColor(Color.BLACK);
+            c.drawPoints(points, 0, n, paintGreen);
 
-        // write the pos as text
-        canvas.drawText("pos = " + pos, 10, 200, paint1);
-        c.drawBitmap(bmp, 0, 0, null);
-        mSurfaceHolder.unlockCanvasAndPost(c);
+            // draw a circle at some position
+            int pos = 50;
+            c.drawCircle(pos, 240, 5, paint1); // x position, y position, diameter, color
+
+            // write the pos as text
+            c.drawText("pos = " + pos, 10, 200, paint1);
+            mSurfaceHolder.unlockCanvasAndPost(c);
+        }
 
         // calculate the FPS to see how fast the code is running
         long nowtime = System.currentTimeMillis();
         long diff = nowtime - prevtime;
-        mTextView.setText("FPS =  " + 1000 / diff);
+        if (diff > 0) {
+            mTextView.setText("FPS =  " + 1000 / diff);
+        }
         prevtime = nowtime;
     }
 }
\ No newline at end of file
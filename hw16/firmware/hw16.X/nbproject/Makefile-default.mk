@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=../../../../../../NU32/harmony/v2_05/framework/system/int/src/sys_int_pic32.c ../../../../../../NU32/harmony/v2_05/framework/driver/usb/usbfs/src/dynamic/drv_usbfs.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device.c ../../../../../../NU32/harmony/v2_05/framework/driver/usb/usbfs/src/dynamic/drv_usbfs_device.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device_cdc.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device_cdc_acm.c ../src/app.c ../src/system_config/default/framework/system/clk/src/sys_clk_pic32mx.c ../src/system_config/default/framework/system/devcon/src/sys_devcon.c ../src/system_config/default/framework/system/devcon/src/sys_devcon_pic32mx.c ../src/system_config/default/framework/system/ports/src/sys_ports_static.c ../src/system_config/default/system_init.c ../src/system_config/default/system_interrupt.c ../src/system_config/default/system_exceptions.c ../src/main.c ../src/system_config/default/system_tasks.c
+SOURCEFILES_QUOTED_IF_SPACED=../../../../../../NU32/harmony/v2_05/framework/system/int/src/sys_int_pic32.c ../../../../../../NU32/harmony/v2_05/framework/driver/usb/usbfs/src/dynamic/drv_usbfs.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device.c ../../../../../../NU32/harmony/v2_05/framework/driver/usb/usbfs/src/dynamic/drv_usbfs_device.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device_cdc.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device_cdc_acm.c ../src/app.c ../src/system_config/default/framework/system/clk/src/sys_clk_pic32mx.c ../src/system_config/default/framework/system/devcon/src/sys_devcon.c ../src/system_config/default/framework/system/devcon/src/sys_devcon_pic32mx.c ../src/system_config/default/framework/system/ports/src/sys_ports_static.c ../src/system_config/default/system_init.c ../src/system_config/default/system_interrupt.c ../src/system_config/default/system_exceptions.c ../src/main.c ../src/system_config/default/system_tasks.c ../src/encoder.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/323954350/sys_int_pic32.o ${OBJECTDIR}/_ext/310695378/drv_usbfs.o ${OBJECTDIR}/_ext/1330747775/usb_device.o ${OBJECTDIR}/_ext/310695378/drv_usbfs_device.o ${OBJECTDIR}/_ext/1330747775/usb_device_cdc.o ${OBJECTDIR}/_ext/1330747775/usb_device_cdc_acm.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/639803181/sys_clk_pic32mx.o ${OBJECTDIR}/_ext/340578644/sys_devcon.o ${OBJECTDIR}/_ext/340578644/sys_devcon_pic32mx.o ${OBJECTDIR}/_ext/822048611/sys_ports_static.o ${OBJECTDIR}/_ext/1688732426/system_init.o ${OBJECTDIR}/_ext/1688732426/system_interrupt.o ${OBJECTDIR}/_ext/1688732426/system_exceptions.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1688732426/system_tasks.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/323954350/sys_int_pic32.o.d ${OBJECTDIR}/_ext/310695378/drv_usbfs.o.d ${OBJECTDIR}/_ext/1330747775/usb_device.o.d ${OBJECTDIR}/_ext/310695378/drv_usbfs_device.o.d ${OBJECTDIR}/_ext/1330747775/usb_device_cdc.o.d ${OBJECTDIR}/_ext/1330747775/usb_device_cdc_acm.o.d ${OBJECTDIR}/_ext/1360937237/app.o.d ${OBJECTDIR}/_ext/639803181/sys_clk_pic32mx.o.d ${OBJECTDIR}/_ext/340578644/sys_devcon.o.d ${OBJECTDIR}/_ext/340578644/sys_devcon_pic32mx.o.d ${OBJECTDIR}/_ext/822048611/sys_ports_static.o.d ${OBJECTDIR}/_ext/1688732426/system_init.o.d ${OBJECTDIR}/_ext/1688732426/system_interrupt.o.d ${OBJECTDIR}/_ext/1688732426/system_exceptions.o.d ${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1688732426/system_tasks.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/323954350/sys_int_pic32.o ${OBJECTDIR}/_ext/310695378/drv_usbfs.o ${OBJECTDIR}/_ext/1330747775/usb_device.o ${OBJECTDIR}/_ext/310695378/drv_usbfs_device.o ${OBJECTDIR}/_ext/1330747775/usb_device_cdc.o ${OBJECTDIR}/_ext/1330747775/usb_device_cdc_acm.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/639803181/sys_clk_pic32mx.o ${OBJECTDIR}/_ext/340578644/sys_devcon.o ${OBJECTDIR}/_ext/340578644/sys_devcon_pic32mx.o ${OBJECTDIR}/_ext/822048611/sys_ports_static.o ${OBJECTDIR}/_ext/1688732426/system_init.o ${OBJECTDIR}/_ext/1688732426/system_interrupt.o ${OBJECTDIR}/_ext/1688732426/system_exceptions.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1688732426/system_tasks.o ${OBJECTDIR}/_ext/1360937237/encoder.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/323954350/sys_int_pic32.o.d ${OBJECTDIR}/_ext/310695378/drv_usbfs.o.d ${OBJECTDIR}/_ext/1330747775/usb_device.o.d ${OBJECTDIR}/_ext/310695378/drv_usbfs_device.o.d ${OBJECTDIR}/_ext/1330747775/usb_device_cdc.o.d ${OBJECTDIR}/_ext/1330747775/usb_device_cdc_acm.o.d ${OBJECTDIR}/_ext/1360937237/app.o.d ${OBJECTDIR}/_ext/639803181/sys_clk_pic32mx.o.d ${OBJECTDIR}/_ext/340578644/sys_devcon.o.d ${OBJECTDIR}/_ext/340578644/sys_devcon_pic32mx.o.d ${OBJECTDIR}/_ext/822048611/sys_ports_static.o.d ${OBJECTDIR}/_ext/1688732426/system_init.o.d ${OBJECTDIR}/_ext/1688732426/system_interrupt.o.d ${OBJECTDIR}/_ext/1688732426/system_exceptions.o.d ${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1688732426/system_tasks.o.d ${OBJECTDIR}/_ext/1360937237/encoder.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/_ext/323954350/sys_int_pic32.o ${OBJECTDIR}/_ext/310695378/drv_usbfs.o ${OBJECTDIR}/_ext/1330747775/usb_device.o ${OBJECTDIR}/_ext/310695378/drv_usbfs_device.o ${OBJECTDIR}/_ext/1330747775/usb_device_cdc.o ${OBJECTDIR}/_ext/1330747775/usb_device_cdc_acm.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/639803181/sys_clk_pic32mx.o ${OBJECTDIR}/_ext/340578644/sys_devcon.o ${OBJECTDIR}/_ext/340578644/sys_devcon_pic32mx.o ${OBJECTDIR}/_ext/822048611/sys_ports_static.o ${OBJECTDIR}/_ext/1688732426/system_init.o ${OBJECTDIR}/_ext/1688732426/system_interrupt.o ${OBJECTDIR}/_ext/1688732426/system_exceptions.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1688732426/system_tasks.o
+OBJECTFILES=${OBJECTDIR}/_ext/323954350/sys_int_pic32.o ${OBJECTDIR}/_ext/310695378/drv_usbfs.o ${OBJECTDIR}/_ext/1330747775/usb_device.o ${OBJECTDIR}/_ext/310695378/drv_usbfs_device.o ${OBJECTDIR}/_ext/1330747775/usb_device_cdc.o ${OBJECTDIR}/_ext/1330747775/usb_device_cdc_acm.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/639803181/sys_clk_pic32mx.o ${OBJECTDIR}/_ext/340578644/sys_devcon.o ${OBJECTDIR}/_ext/340578644/sys_devcon_pic32mx.o ${OBJECTDIR}/_ext/822048611/sys_ports_static.o ${OBJECTDIR}/_ext/1688732426/system_init.o ${OBJECTDIR}/_ext/1688732426/system_interrupt.o ${OBJECTDIR}/_ext/1688732426/system_exceptions.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1688732426/system_tasks.o ${OBJECTDIR}/_ext/1360937237/encoder.o
 
 # Source Files
-SOURCEFILES=../../../../../../NU32/harmony/v2_05/framework/system/int/src/sys_int_pic32.c ../../../../../../NU32/harmony/v2_05/framework/driver/usb/usbfs/src/dynamic/drv_usbfs.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device.c ../../../../../../NU32/harmony/v2_05/framework/driver/usb/usbfs/src/dynamic/drv_usbfs_device.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device_cdc.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device_cdc_acm.c ../src/app.c ../src/system_config/default/framework/system/clk/src/sys_clk_pic32mx.c ../src/system_config/default/framework/system/devcon/src/sys_devcon.c ../src/system_config/default/framework/system/devcon/src/sys_devcon_pic32mx.c ../src/system_config/default/framework/system/ports/src/sys_ports_static.c ../src/system_config/default/system_init.c ../src/system_config/default/system_interrupt.c ../src/system_config/default/system_exceptions.c ../src/main.c ../src/system_config/default/system_tasks.c
+SOURCEFILES=../../../../../../NU32/harmony/v2_05/framework/system/int/src/sys_int_pic32.c ../../../../../../NU32/harmony/v2_05/framework/driver/usb/usbfs/src/dynamic/drv_usbfs.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device.c ../../../../../../NU32/harmony/v2_05/framework/driver/usb/usbfs/src/dynamic/drv_usbfs_device.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device_cdc.c ../../../../../../NU32/harmony/v2_05/framework/usb/src/dynamic/usb_device_cdc_acm.c ../src/app.c ../src/system_config/default/framework/system/clk/src/sys_clk_pic32mx.c ../src/system_config/default/framework/system/devcon/src/sys_devcon.c ../src/system_config/default/framework/system/devcon/src/sys_devcon_pic32mx.c ../src/system_config/default/framework/system/ports/src/sys_ports_static.c ../src/system_config/default/system_init.c ../src/system_config/default/system_interrupt.c ../src/system_config/default/system_exceptions.c ../src/main.c ../src/system_config/default/system_tasks.c ../src/encoder.c
 
 
 CFLAGS=
@@ -148,6 +148,12 @@ ${OBJECTDIR}/_ext/1360937237/app.o: ../src/app.c  nbproject/Makefile-${CND_CONF}
 	@${RM} ${OBJECTDIR}/_ext/1360937237/app.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1360937237/app.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DPICkit3PlatformTool=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -O1 -I"../src" -I"../src/system_config/default" -I"../src/default" -I"../../../../../../NU32/harmony/v2_05/framework" -I"../src/system_config/default/framework" -MMD -MF "${OBJECTDIR}/_ext/1360937237/app.o.d" -o ${OBJECTDIR}/_ext/1360937237/app.o ../src/app.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/_ext/1360937237/encoder.o: ../src/encoder.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
+	@${RM} ${OBJECTDIR}/_ext/1360937237/encoder.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1360937237/encoder.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1360937237/encoder.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -DPICkit3PlatformTool=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -O1 -I"../src" -I"../src/system_config/default" -I"../src/default" -I"../../../../../../NU32/harmony/v2_05/framework" -I"../src/system_config/default/framework" -MMD -MF "${OBJECTDIR}/_ext/1360937237/encoder.o.d" -o ${OBJECTDIR}/_ext/1360937237/encoder.o ../src/encoder.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/_ext/639803181/sys_clk_pic32mx.o: ../src/system_config/default/framework/system/clk/src/sys_clk_pic32mx.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/639803181" 
 	@${RM} ${OBJECTDIR}/_ext/639803181/sys_clk_pic32mx.o.d 
@@ -245,6 +251,12 @@ ${OBJECTDIR}/_ext/1360937237/app.o: ../src/app.c  nbproject/Makefile-${CND_CONF}
 	@${RM} ${OBJECTDIR}/_ext/1360937237/app.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1360937237/app.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -O1 -I"../src" -I"../src/system_config/default" -I"../src/default" -I"../../../../../../NU32/harmony/v2_05/framework" -I"../src/system_config/default/framework" -MMD -MF "${OBJECTDIR}/_ext/1360937237/app.o.d" -o ${OBJECTDIR}/_ext/1360937237/app.o ../src/app.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/_ext/1360937237/encoder.o: ../src/encoder.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
+	@${RM} ${OBJECTDIR}/_ext/1360937237/encoder.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1360937237/encoder.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1360937237/encoder.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -O1 -I"../src" -I"../src/system_config/default" -I"../src/default" -I"../../../../../../NU32/harmony/v2_05/framework" -I"../src/system_config/default/framework" -MMD -MF "${OBJECTDIR}/_ext/1360937237/encoder.o.d" -o ${OBJECTDIR}/_ext/1360937237/encoder.o ../src/encoder.c    -DXPRJ_default=$(CND_CONF)  -no-legacy-libc  $(COMPARISON_BUILD) 
+	
 ${OBJECTDIR}/_ext/639803181/sys_clk_pic32mx.o: ../src/system_config/default/framework/system/clk/src/sys_clk_pic32mx.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/639803181" 
 	@${RM} ${OBJECTDIR}/_ext/639803181/sys_clk_pic32mx.o.d 
@@ -22,7 +22,25 @@ int startTime = 0; // to remember the loop time
 char rx[64]; // the raw data
 int rxPos = 0; // how much data has been stored
 int gotRx = 0; // the flag
-int rxVal = 0; // a place to store the int that was received
+int rxVal = 0; // a place to store the int that was received (line position closest to the robot)
+int rxHeading = 0; // line heading, columns per 100 rows ahead
+int rxCurve = 0; // line curvature, columns the bend adds 100 rows ahead
+
+#define PWM_PERIOD 2400     // Timer2 period, 48 MHz / 2400 = 20 kHz PWM
+#define MAX_SPEED 3000      // wheel speed on the straights, in encoder edges per second
+#define KP_STEER 10         // speed taken off the inside wheel per pixel of error
+#define LOOKAHEAD 100       // rows ahead of the robot the steering error is taken at
+#define KFF_CURVE 20        // speed taken off the inside wheel per pixel of curvature, before the corner arrives
+#define KSLOW_CURVE 10      // speed taken off both wheels per pixel of curvature
+#define MIN_SPEED 1000      // never slow down more than this for a corner
+#define VEL_LOOP_HZ 200     // inner velocity loop rate
+#define VEL_KP 2            // duty counts per (edge/s) of speed error, divided by VEL_DIV
+#define VEL_KI 1            // duty counts per (edge/s) of error held for a second, divided by VEL_DIV
+#define VEL_DIV 4
+
+int speedRef[ENCODER_NUM] = {0, 0};  // wheel speed setpoints from the steering controller
+int speedInt[ENCODER_NUM] = {0, 0};  // velocity loop integrators, the speed errors summed every loop
+int velTime = 0;                     // to remember the velocity loop time
 
 // *****************************************************************************
 /* Application Data
@@ -218,6 +236,44 @@ void APP_USBDeviceEventHandler(USB_DEVICE_EVENT event, void * eventData, uintptr
 // *****************************************************************************
 // *****************************************************************************
 
+/*****************************************************
+ * Inner velocity loop. Feed forward the setpoint and
+ * PI correct on the measured wheel speed, so the duty
+ * cycle follows battery sag and floor friction.
+ *****************************************************/
+
+void APP_VelocityLoop(void) {
+    int w, err, duty;
+
+    encoder_update();
+
+    for (w = 0; w < ENCODER_NUM; w++) {
+        err = speedRef[w] - encoder_velocity(w);
+        speedInt[w] += err;         // scaled by 1/VEL_LOOP_HZ below, so small errors still add up
+
+        // anti windup: the integrator alone can never ask for more than full duty
+        if (speedInt[w] > PWM_PERIOD * VEL_DIV * VEL_LOOP_HZ / VEL_KI) {
+            speedInt[w] = PWM_PERIOD * VEL_DIV * VEL_LOOP_HZ / VEL_KI;
+        } else if (speedInt[w] < -PWM_PERIOD * VEL_DIV * VEL_LOOP_HZ / VEL_KI) {
+            speedInt[w] = -PWM_PERIOD * VEL_DIV * VEL_LOOP_HZ / VEL_KI;
+        }
+
+        duty = speedRef[w] * PWM_PERIOD / MAX_SPEED + VEL_KP * err / VEL_DIV
+                + VEL_KI * speedInt[w] / (VEL_DIV * VEL_LOOP_HZ);
+        if (duty < 0) {
+            duty = 0;
+        } else if (duty > PWM_PERIOD) {
+            duty = PWM_PERIOD;
+        }
+
+        if (w == ENCODER_LEFT) {
+            OC1RS = duty;
+        } else {
+            OC4RS = duty;
+        }
+    }
+}
+
 /*****************************************************
  * This function is called in every step of the
  * application state machine.
@@ -298,7 +354,28 @@ void APP_Initialize(void) {
     TRISAbits.TRISA4 = 0;                                        // set up green LED heartbeat check
     LATAbits.LATA4 = 0;  
 
+    // motor PWM: OC1 on A0 (left), OC4 on B13 (right), both from Timer2
+    ANSELAbits.ANSA0 = 0;
+    ANSELBbits.ANSB13 = 0;
+    RPA0Rbits.RPA0R = 0b0101;                                    // A0 is OC1
+    RPB13Rbits.RPB13R = 0b0101;                                  // B13 is OC4
+    T2CONbits.TCKPS = 0;                                         // 1:1 prescaler
+    PR2 = PWM_PERIOD - 1;
+    TMR2 = 0;
+    OC1CONbits.OCM = 0b110;                                      // PWM mode without fault pin
+    OC4CONbits.OCM = 0b110;
+    OC1RS = 0;
+    OC1R = 0;
+    OC4RS = 0;
+    OC4R = 0;
+    T2CONbits.ON = 1;
+    OC1CONbits.ON = 1;
+    OC4CONbits.ON = 1;
+
+    encoder_setup();                                             // wheel encoders on IC3/IC2
+
     startTime = _CP0_GET_COUNT();
+    velTime = _CP0_GET_COUNT();
 }
 
 /******************************************************************************
@@ -309,6 +386,13 @@ void APP_Initialize(void) {
  */
 
 void APP_Tasks(void) {
+    /* Run the velocity loop at a fixed rate, whatever
+     * state the USB side is in */
+    if (_CP0_GET_COUNT() - velTime > (48000000 / 2 / VEL_LOOP_HZ)) {
+        velTime = _CP0_GET_COUNT();
+        APP_VelocityLoop();
+    }
+
     /* Update the application state machine based
      * on the current state */
 
@@ -366,7 +450,9 @@ void APP_Tasks(void) {
                     // if you got a newline
                     if (appData.readBuffer[ii] == '\n' || appData.readBuffer[ii] == '\r') {
                         rx[rxPos] = 0; // end the array
-                        sscanf(rx, "%d", &rxVal); // get the int out of the array
+                        rxHeading = 0; // an old app only sends the position
+                        rxCurve = 0;
+                        sscanf(rx, "%d %d %d", &rxVal, &rxHeading, &rxCurve); // get the ints out of the array
                         gotRx = 1; // set the flag
                         break; // get out of the while loop
                     } else if (appData.readBuffer[ii] == 0) {
@@ -407,10 +493,9 @@ void APP_Tasks(void) {
 
 
         case APP_STATE_SCHEDULE_WRITE:
+        {
             int error = 0;
-            int left, right;
-            int MAX_DUTY;
-            int kp = 0;
+            int steer, base;
 
             if (APP_StateReset()) {
                 break;
@@ -421,25 +506,28 @@ void APP_Tasks(void) {
             appData.isWriteComplete = false;
             appData.state = APP_STATE_WAIT_FOR_WRITE_COMPLETE;
 
-            /* PI motor control */
-            error = rxVal - 240; // 240 means the dot is in the middle of the screen
-                    if (error<0) { // slow down the left motor to steer to the left
-                        error = -error;
-                        left = MAX_DUTY - kp*error;
-                        right = MAX_DUTY;
-                        if (left < 0){
-                            left = 0;
+            /* P steering control with curvature feed forward, sets the wheel speeds for the velocity loop */
+            error = rxVal - 240 + (rxHeading * LOOKAHEAD) / 100; // 240 means the dot is in the middle of the screen
+            steer = KP_STEER*error + KFF_CURVE*rxCurve; // start turning before the corner reaches the robot
+            base = MAX_SPEED - KSLOW_CURVE*abs(rxCurve); // and slow down for it
+            if (base < MIN_SPEED) {
+                base = MIN_SPEED;
+            }
+                    if (steer<0) { // slow down the left wheel to steer to the left
+                        steer = -steer;
+                        speedRef[ENCODER_LEFT] = base - steer;
+                        speedRef[ENCODER_RIGHT] = base;
+                        if (speedRef[ENCODER_LEFT] < 0){
+                            speedRef[ENCODER_LEFT] = 0;
                         }
                     }
-                    else {        // slow down the right motor to steer to the right
-                        right = MAX_DUTY - kp*error;
-                        left = MAX_DUTY;
-                        if (right<0) {
-                            right = 0;
+                    else {        // slow down the right wheel to steer to the right
+                        speedRef[ENCODER_RIGHT] = base - steer;
+                        speedRef[ENCODER_LEFT] = base;
+                        if (speedRef[ENCODER_RIGHT]<0) {
+                            speedRef[ENCODER_RIGHT] = 0;
                         }
                     }
-                    OC1RS = left;
-                    OC4RS = right;
             
             /* IF A LETTER WAS RECEIVED, ECHO IT BACK SO THE USER CAN SEE IT */
             if (gotRx) {
@@ -462,6 +550,7 @@ void APP_Tasks(void) {
                 startTime = _CP0_GET_COUNT(); // reset the timer for accurate delays
             }
             break;
+        }
 
         case APP_STATE_WAIT_FOR_WRITE_COMPLETE:
 
@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include "system_config.h"
 #include "system_definitions.h"
+#include "encoder.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
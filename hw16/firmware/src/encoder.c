@@ -0,0 +1,172 @@
+#include <xc.h>
+#include "encoder.h"
+
+// Wheel encoder capture using Input Capture, timestamps from Timer3
+// Each rising edge is timestamped in hardware, so the speed estimate does not
+// depend on how long the app state machine takes to come back around.
+
+// pin connections:
+// left encoder  - B8 (IC3)
+// right encoder - B9 (IC2)
+
+// the encoders are single channel, so speed is a magnitude (the robot only drives forward)
+
+typedef struct {
+    volatile unsigned int edges;    // total edges seen
+    volatile unsigned int lastEdge; // timestamp of the newest edge
+    volatile unsigned int prevEdge; // timestamp of the edge before that
+    unsigned int windowEdges;       // edges at the previous encoder_update()
+    unsigned int windowTime;        // lastEdge at the previous encoder_update()
+    int velocity;                   // edges per second
+} encoder_t;
+
+static encoder_t enc[ENCODER_NUM];
+static volatile unsigned int overflows = 0; // Timer3 rollovers, the upper 16 bits of a timestamp
+
+// extend a 16 bit Timer3 value, taken less than a rollover ago, to 32 bits
+// the ISRs run at the same priority as the T3 ISR, so it can't run in here,
+// but it may or may not have counted the newest rollover yet: a t later than
+// the timer is now was taken before that rollover, and overflows is one
+// ahead of it if the T3 ISR has already run; a pending T3IF means overflows
+// is one behind for everything since the rollover
+static unsigned int encoder_stamp(unsigned short t) {
+    unsigned int hi = overflows;
+    unsigned int pending;
+    unsigned short now;
+
+    do {
+        pending = IFS0bits.T3IF;
+        now = TMR3;
+    } while (pending != IFS0bits.T3IF);     // rolled over between the two reads
+    if (t > now) {
+        hi--;
+    }
+    if (pending) {
+        hi++;
+    }
+    return (hi << 16) | t;
+}
+
+static unsigned int encoder_now(void) {
+    unsigned int now;
+    __builtin_disable_interrupts();
+    now = encoder_stamp(TMR3);
+    __builtin_enable_interrupts();
+    return now;
+}
+
+void encoder_setup(void) {
+    int w;
+    for (w = 0; w < ENCODER_NUM; w++) {
+        enc[w].edges = 0;
+        enc[w].lastEdge = 0;
+        enc[w].prevEdge = 0;
+        enc[w].windowEdges = 0;
+        enc[w].windowTime = 0;
+        enc[w].velocity = 0;
+    }
+
+    // Timer3 free runs as the capture time base
+    T3CON = 0;
+    T3CONbits.TCKPS = 0b110;   // 1:64 prescaler, 750 kHz
+    PR3 = 0xFFFF;              // roll over every 87 ms
+    TMR3 = 0;
+    IPC3bits.T3IP = 5;
+    IFS0bits.T3IF = 0;
+    IEC0bits.T3IE = 1;
+
+    IC3Rbits.IC3R = 0b0100;    // B8 is IC3
+    IC2Rbits.IC2R = 0b0100;    // B9 is IC2
+
+    IC3CON = 0;
+    IC3CONbits.ICTMR = 0;      // use Timer3
+    IC3CONbits.ICM = 0b011;    // capture every rising edge
+    IPC3bits.IC3IP = 5;
+    IFS0bits.IC3IF = 0;
+    IEC0bits.IC3IE = 1;
+
+    IC2CON = 0;
+    IC2CONbits.ICTMR = 0;
+    IC2CONbits.ICM = 0b011;
+    IPC2bits.IC2IP = 5;
+    IFS0bits.IC2IF = 0;
+    IEC0bits.IC2IE = 1;
+
+    IC3CONbits.ON = 1;
+    IC2CONbits.ON = 1;
+    T3CONbits.ON = 1;
+}
+
+void encoder_capture_isr(int wheel) {
+    encoder_t *e = &enc[wheel];
+
+    if (wheel == ENCODER_LEFT) {
+        while (IC3CONbits.ICBNE) {     // there may be more than one edge queued
+            e->prevEdge = e->lastEdge;
+            e->lastEdge = encoder_stamp(IC3BUF);
+            e->edges++;
+        }
+        IFS0bits.IC3IF = 0;
+    } else {
+        while (IC2CONbits.ICBNE) {
+            e->prevEdge = e->lastEdge;
+            e->lastEdge = encoder_stamp(IC2BUF);
+            e->edges++;
+        }
+        IFS0bits.IC2IF = 0;
+    }
+}
+
+void encoder_timer_isr(void) {
+    overflows++;
+    IFS0bits.T3IF = 0;
+}
+
+// speed from the edges since the last update, blended with the last edge period
+// many edges:  edges / (time they span)  - accurate at speed
+// few edges:   1 / (last edge period)    - still updates when the wheel is slow
+// no edges:    the speed can be at most 1 / (time since the last edge)
+void encoder_update(void) {
+    unsigned int now = encoder_now();
+    int w;
+
+    for (w = 0; w < ENCODER_NUM; w++) {
+        encoder_t *e = &enc[w];
+        unsigned int edges, last, prev, n, period = 0, freq = 0;
+
+        __builtin_disable_interrupts();
+        edges = e->edges;
+        last = e->lastEdge;
+        prev = e->prevEdge;
+        __builtin_enable_interrupts();
+
+        n = edges - e->windowEdges;
+
+        if (edges >= 2 && last != prev) {
+            period = ENCODER_TICK_HZ / (last - prev);
+        }
+        if (n > 0 && e->windowEdges > 0 && last != e->windowTime) {
+            freq = (unsigned int) (((unsigned long long) n * ENCODER_TICK_HZ) / (last - e->windowTime));
+        }
+
+        if (edges < 2 || now - last > ENCODER_TICK_HZ / ENCODER_STOP_HZ) {
+            e->velocity = 0;
+        } else if (n == 0) {
+            unsigned int bound = ENCODER_TICK_HZ / (now - last + 1);
+            e->velocity = (period < bound) ? period : bound;
+        } else if (n >= ENCODER_BLEND_EDGES || e->windowEdges == 0) {
+            e->velocity = (freq > 0) ? freq : period;
+        } else {
+            e->velocity = (freq * n + period * (ENCODER_BLEND_EDGES - n)) / ENCODER_BLEND_EDGES;
+        }
+
+        if (n > 0) {
+            e->windowEdges = edges;
+            e->windowTime = last;
+        }
+    }
+}
+
+int encoder_velocity(int wheel) {
+    return enc[wheel].velocity;
+}
@@ -0,0 +1,20 @@
+#ifndef ENCODER_H__
+#define ENCODER_H__
+// Header file for encoder.c
+// timestamps wheel encoder edges with Input Capture and estimates wheel speed
+
+#define ENCODER_LEFT  0             // IC3 on B8
+#define ENCODER_RIGHT 1             // IC2 on B9
+#define ENCODER_NUM   2
+
+#define ENCODER_TICK_HZ     750000  // Timer3 = PBCLK/64, one timestamp tick every 1.33 us
+#define ENCODER_BLEND_EDGES 4       // edges per update above which only the frequency estimate is used
+#define ENCODER_STOP_HZ     5       // edge rates below this are reported as a stopped wheel
+
+void encoder_setup(void);           // set up Timer3, IC3 and IC2 and their interrupts
+void encoder_capture_isr(int wheel); // drain the capture buffer, called from the IC ISRs
+void encoder_timer_isr(void);       // count Timer3 rollovers, called from the T3 ISR
+void encoder_update(void);          // recompute both wheel speeds, call at the control loop rate
+int encoder_velocity(int wheel);    // wheel speed in edges per second, from the last update
+
+#endif
@@ -75,6 +75,21 @@ void __ISR(_USB_1_VECTOR, ipl4AUTO) _IntHandlerUSBInstance0(void)
     DRV_USBFS_Tasks_ISR(sysObj.drvUSBObject);
 }
 
+void __ISR(_INPUT_CAPTURE_3_VECTOR, ipl5AUTO) _IntHandlerEncoderLeft(void)
+{
+    encoder_capture_isr(ENCODER_LEFT);
+}
+
+void __ISR(_INPUT_CAPTURE_2_VECTOR, ipl5AUTO) _IntHandlerEncoderRight(void)
+{
+    encoder_capture_isr(ENCODER_RIGHT);
+}
+
+void __ISR(_TIMER_3_VECTOR, ipl5AUTO) _IntHandlerEncoderTimer(void)
+{
+    encoder_timer_isr();
+}
+
 /*******************************************************************************
  End of File
 */
@@ -0,0 +1,226 @@
+// Linux benchmark driver for the line detection kernel
+// feeds recorded frames through LineDetector and reports the result, the
+// fitted line model and the time per frame
+//   frame.ppm  - binary PPM (e.g. a saved screenshot), run through the RGB
+//                path and, converted to NV21, through the unrotated YUV path
+//                and the rotated one
+//   frame.nv21 - raw preview buffer from onPreviewFrame, run through the YUV
+//                path rotated to portrait the way the app does, once scanning
+//                whole rows and once through the tracker (windowed after the
+//                first frame, since the frame repeats)
+// The rotated YUV path ("rot90") is the one MainActivity.onPreviewFrame uses;
+// the others are there to compare it with.
+//
+// usage: line_bench [-t threads] [-n iterations] [-R variance] [-T threshold]
+//                   [-s WIDTHxHEIGHT of .nv21 frames] frame.ppm|frame.nv21 ...
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "line_detect.h"
+
+// read a binary (P6) PPM with maxval 255 into 0xAARRGGBB pixels
+static bool readPPM(const char *path, std::vector<uint32_t> &pixels, int &width, int &height) {
+    FILE *f = fopen(path, "rb");
+    if (f == nullptr) {
+        return false;
+    }
+    int maxval = 0;
+    char magic[3] = {0};
+    bool ok = fscanf(f, "%2s", magic) == 1 && strcmp(magic, "P6") == 0;
+    // skip comment lines between the header fields
+    for (int *field : {&width, &height, &maxval}) {
+        int ch;
+        while (ok && (ch = fgetc(f)) != EOF) {
+            if (ch == '#') {
+                while ((ch = fgetc(f)) != EOF && ch != '\n') {}
+            } else if (ch > ' ') {
+                ungetc(ch, f);
+                break;
+            }
+        }
+        ok = ok && fscanf(f, "%d", field) == 1;
+    }
+    ok = ok && maxval == 255 && width > 0 && height > 0 && fgetc(f) != EOF;
+
+    if (ok) {
+        std::vector<unsigned char> rgb((size_t) width * height * 3);
+        ok = fread(rgb.data(), 1, rgb.size(), f) == rgb.size();
+        pixels.resize((size_t) width * height);
+        for (size_t i = 0; ok && i < pixels.size(); i++) {
+            pixels[i] = 0xFF000000u | (rgb[3 * i] << 16) | (rgb[3 * i + 1] << 8) | rgb[3 * i + 2];
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+// read a raw NV21 frame of a known size
+static bool readNV21(const char *path, std::vector<uint8_t> &nv21, int width, int height) {
+    FILE *f = fopen(path, "rb");
+    if (f == nullptr) {
+        return false;
+    }
+    nv21.resize((size_t) width * height * 3 / 2);
+    bool ok = fread(nv21.data(), 1, nv21.size(), f) == nv21.size();
+    fclose(f);
+    return ok;
+}
+
+// BT.601 full range, like the camera's JPEG/YUV output; chroma is the mean of each 2x2 block
+static void toNV21(const std::vector<uint32_t> &pixels, int width, int height, std::vector<uint8_t> &nv21) {
+    nv21.assign((size_t) width * height + (size_t) width * ((height + 1) / 2), 128);
+    uint8_t *vu = nv21.data() + (size_t) width * height;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint32_t p = pixels[(size_t) y * width + x];
+            int r = (p >> 16) & 0xFF, g = (p >> 8) & 0xFF, b = p & 0xFF;
+            nv21[(size_t) y * width + x] = (uint8_t) ((299 * r + 587 * g + 114 * b + 500) / 1000);
+        }
+    }
+    for (int y = 0; y + 1 < height; y += 2) {
+        for (int x = 0; x + 1 < width; x += 2) {
+            int r = 0, g = 0, b = 0;
+            for (int j = 0; j < 4; j++) {
+                uint32_t p = pixels[(size_t) (y + j / 2) * width + x + j % 2];
+                r += (p >> 16) & 0xFF;
+                g += (p >> 8) & 0xFF;
+                b += p & 0xFF;
+            }
+            int v = 128 + (5000 * r - 4187 * g - 813 * b) / 40000;
+            int u = 128 + (-1687 * r - 3313 * g + 5000 * b) / 40000;
+            vu[(size_t) (y / 2) * width + x] = (uint8_t) std::min(255, std::max(0, v));
+            vu[(size_t) (y / 2) * width + x + 1] = (uint8_t) std::min(255, std::max(0, u));
+        }
+    }
+}
+
+template <typename F>
+static double timeUs(int iterations, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        f();
+    }
+    return std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+static void reportTrack(const linedetect::Track &tr, int full, double us) {
+    printf("    track com=%d count=%d  %.1f us/frame  confidence=%d windowed=%d  scanned %d of %d pixels\n",
+           tr.result.com, tr.result.count, us, tr.confidence, tr.windowed, tr.result.scanned, full);
+    printf("          model: valid=%d bands=%d position=%.1f heading=%.4f curvature=%.6f rms=%.2f\n",
+           tr.model.valid, tr.model.bands, tr.model.position, tr.model.heading, tr.model.curvature,
+           tr.model.rms);
+}
+
+static void report(const char *what, const linedetect::Result &res, const linedetect::LineModel &m,
+                   double us, double fitUs) {
+    printf("    %-5s com=%d count=%d  %.1f us/frame\n", what, res.com, res.count, us);
+    printf("          model: valid=%d bands=%d position=%.1f heading=%.4f curvature=%.6f rms=%.2f  %.1f us/fit\n",
+           m.valid, m.bands, m.position, m.heading, m.curvature, m.rms, fitUs);
+}
+
+// the app scans the portrait image, display rows 100-400 stretched to 480/640
+static linedetect::Params portrait(const linedetect::Params &p, int width, int height) {
+    linedetect::Params pr = p;
+    pr.rowStart = p.rowStart * width / height;
+    pr.rowEnd = p.rowEnd * width / height;
+    return pr;
+}
+
+int main(int argc, char **argv) {
+    int threads = 1;
+    int iterations = 1000;
+    int nvWidth = 640, nvHeight = 480;
+    linedetect::Params p = {20, 20, 100, 400, 5};  // the app's default slider settings
+    int first = 1;
+
+    for (; first < argc && argv[first][0] == '-' && first + 1 < argc; first += 2) {
+        int v = atoi(argv[first + 1]);
+        switch (argv[first][1]) {
+            case 't': threads = v; break;
+            case 'n': iterations = v; break;
+            case 'R': p.R = v; break;
+            case 'T': p.T = v; break;
+            case 's':
+                if (sscanf(argv[first + 1], "%dx%d", &nvWidth, &nvHeight) != 2) {
+                    fprintf(stderr, "bad frame size %s\n", argv[first + 1]);
+                    return 2;
+                }
+                break;
+            default:
+                fprintf(stderr, "unknown option %s\n", argv[first]);
+                return 2;
+        }
+    }
+    if (first >= argc || iterations < 1) {
+        fprintf(stderr, "usage: %s [-t threads] [-n iterations] [-R variance] [-T threshold] "
+                "[-s WIDTHxHEIGHT] frame.ppm|frame.nv21 ...\n", argv[0]);
+        return 2;
+    }
+
+    linedetect::LineDetector detector(threads);
+    linedetect::LineTracker tracker(detector, 6, 40, 40);  // as in line_detect_jni.cpp
+    double totalUs = 0;
+    int frames = 0;
+
+    for (int a = first; a < argc; a++) {
+        std::string path = argv[a];
+        linedetect::Result res = {0, 0, 0, 0};
+        linedetect::LineModel m = {false, 0, 0, 0, 0, 0};
+        double us, fitUs;
+
+        printf("%s:\n", argv[a]);
+        if (path.size() > 5 && path.compare(path.size() - 5, 5, ".nv21") == 0) {
+            std::vector<uint8_t> nv21;
+            if (!readNV21(argv[a], nv21, nvWidth, nvHeight)) {
+                fprintf(stderr, "%s: shorter than a %dx%d NV21 frame\n", argv[a], nvWidth, nvHeight);
+                return 1;
+            }
+            linedetect::Params pr = portrait(p, nvWidth, nvHeight);
+            us = timeUs(iterations, [&] { res = detector.detectNV21(nv21.data(), nvWidth, nvHeight, true, pr); });
+            fitUs = timeUs(iterations, [&] { m = detector.fit(6); });
+            report("rot90", res, m, us, fitUs);
+
+            linedetect::Track tr;
+            int full = res.scanned;
+            tracker.reset();
+            us = timeUs(iterations, [&] { tr = tracker.detectNV21(nv21.data(), nvWidth, nvHeight, true, pr); });
+            reportTrack(tr, full, us);
+        } else {
+            std::vector<uint32_t> pixels;
+            std::vector<uint8_t> nv21;
+            int width = 0, height = 0;
+            if (!readPPM(argv[a], pixels, width, height)) {
+                fprintf(stderr, "%s: not a binary 8 bit PPM\n", argv[a]);
+                return 1;
+            }
+            us = timeUs(iterations, [&] {
+                res = detector.detect(pixels.data(), width, height, width, linedetect::ORDER_ARGB, p);
+            });
+            fitUs = timeUs(iterations, [&] { m = detector.fit(6); });
+            report("rgb", res, m, us, fitUs);
+
+            toNV21(pixels, width, height, nv21);
+            us = timeUs(iterations, [&] { res = detector.detectNV21(nv21.data(), width, height, false, p); });
+            fitUs = timeUs(iterations, [&] { m = detector.fit(6); });
+            report("yuv", res, m, us, fitUs);
+
+            linedetect::Params pr = portrait(p, width, height);
+            us = timeUs(iterations, [&] { res = detector.detectNV21(nv21.data(), width, height, true, pr); });
+            fitUs = timeUs(iterations, [&] { m = detector.fit(6); });
+            report("rot90", res, m, us, fitUs);
+        }
+        totalUs += us;
+        frames++;
+    }
+
+    printf("%d frame(s), %d thread(s): mean %.1f us/frame (%.0f frames/s)\n",
+           frames, detector.threads(), totalUs / frames, 1e6 * frames / totalUs);
+    return 0;
+}
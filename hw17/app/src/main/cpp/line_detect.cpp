@@ -0,0 +1,494 @@
+#include "line_detect.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace linedetect {
+
+// The test is written without branches so the compiler can vectorize the loop
+// (NEON on the phone, SSE on the bench machine). Every matching pixel has the
+// same mass, so the center of mass is just the mean column.
+template <int RS, int GS, int BS>
+static void scanRowT(const uint32_t *row, int width, int R, int T,
+                     int &count, long long &sumX) {
+    int c = 0;
+    int s = 0;  // 640 columns * 640 fits easily
+    for (int x = 0; x < width; x++) {
+        uint32_t p = row[x];
+        int r = (p >> RS) & 0xFF;
+        int g = (p >> GS) & 0xFF;
+        int b = (p >> BS) & 0xFF;
+        int d = r - ((g + b) >> 1);
+        int m = (d > -R) & (d < R) & (r > T);
+        c += m;
+        s += m * x;
+    }
+    count += c;
+    sumX += s;
+}
+
+void scanRow(const uint32_t *row, int width, PixelOrder order, int R, int T,
+             int &count, long long &sumX) {
+    if (order == ORDER_ARGB) {
+        scanRowT<16, 8, 0>(row, width, R, T, count, sumX);
+    } else {
+        scanRowT<0, 8, 16>(row, width, R, T, count, sumX);
+    }
+}
+
+// The YUV test uses only Y and Cr (V), so the preview never has to be
+// converted to RGB. With red = Y + 1.402 Cr and
+// red - (green+blue)/2 = 1.759 Cr - 0.714 Cb, dropping the Cb term gives
+// -R < 1.75 Cr < R and Y + 1.4 Cr > T. Shifts rather than divides keep
+// the loop vectorizable.
+static inline int matchYV(int y, int v, int R, int T) {
+    int cr = v - 128;
+    int d = (cr * 7) >> 2;
+    int r = y + ((cr * 45) >> 5);
+    return (d > -R) & (d < R) & (r > T);
+}
+
+void scanRowNV21(const uint8_t *yRow, const uint8_t *vuRow, int width, int R, int T,
+                 int &count, long long &sumX) {
+    int c = 0;
+    int s = 0;
+    // two luma samples share each V sample
+    int x = 0;
+    for (; x + 1 < width; x += 2) {
+        int v = vuRow[x];
+        int m0 = matchYV(yRow[x], v, R, T);
+        int m1 = matchYV(yRow[x + 1], v, R, T);
+        c += m0 + m1;
+        s += m0 * x + m1 * (x + 1);
+    }
+    if (x < width) {
+        int m = matchYV(yRow[x], vuRow[x], R, T);
+        c += m;
+        s += m * x;
+    }
+    count += c;
+    sumX += s;
+}
+
+LineDetector::LineDetector(int threads)
+    : rows_(0), ys0_(0), generation_(0), pending_(0), quit_(false),
+      format_(FRAME_RGB32), pixels_(nullptr), nv21_(nullptr),
+      width_(0), height_(0), stride_(0), order_(ORDER_ARGB), params_() {
+    if (threads < 1) {
+        threads = 1;
+    }
+    bands_.resize(threads);
+    // band 0 runs on the calling thread
+    for (int i = 1; i < threads; i++) {
+        workers_.emplace_back(&LineDetector::worker, this, i);
+    }
+}
+
+LineDetector::~LineDetector() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        quit_ = true;
+    }
+    wake_.notify_all();
+    for (auto &t : workers_) {
+        t.join();
+    }
+}
+
+void LineDetector::worker(int id) {
+    unsigned seen = 0;
+    for (;;) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [&] { return quit_ || generation_ != seen; });
+        if (quit_) {
+            return;
+        }
+        seen = generation_;
+        lock.unlock();
+
+        runBand(id);
+
+        lock.lock();
+        if (--pending_ == 0) {
+            done_.notify_one();
+        }
+    }
+}
+
+void LineDetector::runBand(int id) {
+    Band &band = bands_[id];
+    band.count = 0;
+    band.sumX = 0;
+    if (format_ == FRAME_NV21_ROT90) {
+        runBandRot90(band);
+        return;
+    }
+    for (int k = band.k0; k < band.k1; k++) {
+        int y = params_.rowStart + k * params_.rowStep;
+        int lo = spans_[k].lo;
+        int n = spans_[k].hi - lo;
+        int count = 0;
+        long long sumX = 0;
+        if (n <= 0) {
+            // nothing of this row is in the window
+        } else if (format_ == FRAME_RGB32) {
+            scanRow(pixels_ + (size_t) y * stride_ + lo, n, order_, params_.R, params_.T,
+                    count, sumX);
+        } else {
+            // lo is even, so the V,U pairs stay aligned
+            scanRowNV21(nv21_ + (size_t) y * width_ + lo,
+                        nv21_ + (size_t) width_ * height_ + (size_t) (y >> 1) * width_ + lo,
+                        n, params_.R, params_.T, count, sumX);
+        }
+        sumX += (long long) count * lo;  // the scan counted columns from lo
+        rowCount_[k] = count;
+        rowSumX_[k] = sumX;
+        band.count += count;
+        band.sumX += sumX;
+    }
+}
+
+// A scanned row of the rotated image is a column of the frame, so walking it
+// directly would touch a new cache line for every pixel. Instead each band
+// walks whole frame rows, keeping its own per scanned row sums that are added
+// up once all bands are done. Each frame row's pixels of the scanned rows are
+// first gathered into a short contiguous row, which is then tested like
+// scanRowNV21 tests a frame row: without branches, into int sums, so the
+// compiler can vectorize it. With a window only the frame rows it spans are
+// walked.
+void LineDetector::runBandRot90(Band &band) {
+    band.rowCount.assign(rows_, 0);
+    band.rowSumX.assign(rows_, 0);
+    band.y.resize(rows_);
+    band.v.resize(rows_);
+    int *count = band.rowCount.data();
+    int *sumX = band.rowSumX.data();
+    uint8_t *yk = band.y.data();
+    uint8_t *vk = band.v.data();
+    const Span *spans = spans_.data();
+    // locals, so the stores into the sums can't be taken to change them
+    int rows = rows_, start = params_.rowStart, step = params_.rowStep;
+    int R = params_.R, T = params_.T;
+    for (int ys = ys0_ + band.k0; ys < ys0_ + band.k1; ys++) {
+        const uint8_t *yRow = nv21_ + (size_t) ys * width_;
+        const uint8_t *vuRow = nv21_ + (size_t) width_ * height_ + (size_t) (ys >> 1) * width_;
+        int x = height_ - 1 - ys;  // column in the rotated image
+        for (int k = 0, xs = start; k < rows; k++, xs += step) {
+            yk[k] = yRow[xs];
+            vk[k] = vuRow[xs & ~1];
+        }
+        for (int k = 0; k < rows; k++) {
+            int m = matchYV(yk[k], vk[k], R, T) & (x >= spans[k].lo) & (x < spans[k].hi);
+            count[k] += m;
+            sumX[k] += m * x;
+        }
+    }
+}
+
+Result LineDetector::detect(const uint32_t *pixels, int width, int height, int stride,
+                            PixelOrder order, const Params &p) {
+    int rowEnd = p.rowEnd < height ? p.rowEnd : height;
+    int step = p.rowStep > 0 ? p.rowStep : 1;
+    int rows = rowEnd > p.rowStart ? (rowEnd - p.rowStart + step - 1) / step : 0;
+
+    format_ = FRAME_RGB32;
+    pixels_ = pixels;
+    width_ = width;
+    height_ = height;
+    stride_ = stride;
+    order_ = order;
+    params_ = p;
+    params_.rowStep = step;
+    return run(width > 0 ? rows : 0);
+}
+
+Result LineDetector::detectNV21(const uint8_t *nv21, int width, int height, bool rotate90,
+                                const Params &p) {
+    // the rotated image is height wide and width tall
+    int outHeight = rotate90 ? width : height;
+    int rowEnd = p.rowEnd < outHeight ? p.rowEnd : outHeight;
+    int step = p.rowStep > 0 ? p.rowStep : 1;
+    int rows = rowEnd > p.rowStart ? (rowEnd - p.rowStart + step - 1) / step : 0;
+
+    format_ = rotate90 ? FRAME_NV21_ROT90 : FRAME_NV21;
+    nv21_ = nv21;
+    width_ = width;
+    height_ = height;
+    stride_ = width;
+    params_ = p;
+    params_.rowStep = step;
+    return run(width > 0 && height > 0 ? rows : 0);
+}
+
+// scan `rows` rows, splitting them (or for FRAME_NV21_ROT90 the frame rows) between the bands
+Result LineDetector::run(int rows) {
+    Result res = {0, 0, 0, 0};
+
+    rows_ = rows;
+    if (rows == 0) {
+        return res;
+    }
+    rowCount_.resize(rows);
+    rowSumX_.resize(rows);
+
+    // clip the window to the (rotated) image, lo rounded down to even for the NV21 chroma pairs
+    int rowWidth = format_ == FRAME_NV21_ROT90 ? height_ : width_;
+    bool windowed = (int) window_.size() == rows;
+    int lo = rowWidth, hi = 0;
+    spans_.resize(rows);
+    for (int r = 0; r < rows; r++) {
+        Span sp = {0, rowWidth};
+        if (windowed) {
+            sp.lo = std::max(0, std::min(rowWidth, window_[r].lo)) & ~1;
+            sp.hi = std::max(sp.lo, std::min(rowWidth, window_[r].hi));
+        }
+        spans_[r] = sp;
+        lo = std::min(lo, sp.lo);
+        hi = std::max(hi, sp.hi);
+        res.scanned += sp.hi - sp.lo;
+    }
+    int work = rows;
+    if (format_ == FRAME_NV21_ROT90) {
+        // columns [lo, hi) of the rotated image are frame rows [height - hi, height - lo)
+        ys0_ = height_ - std::max(hi, lo);
+        work = std::max(hi, lo) - lo;
+        res.scanned = work * rows;
+        if (work == 0) {
+            std::fill(rowCount_.begin(), rowCount_.end(), 0);
+            std::fill(rowSumX_.begin(), rowSumX_.end(), 0);
+            return res;
+        }
+    }
+
+    // split the work evenly, the first bands take the remainder
+    int n = (int) bands_.size();
+    if (n > work) {
+        n = work;
+    }
+    int k = 0;
+    for (int i = 0; i < (int) bands_.size(); i++) {
+        int len = i < n ? work / n + (i < work % n ? 1 : 0) : 0;
+        bands_[i].k0 = k;
+        bands_[i].k1 = k + len;
+        k += len;
+    }
+
+    if (bands_.size() > 1) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_ = (int) bands_.size() - 1;
+            generation_++;
+        }
+        wake_.notify_all();
+    }
+
+    runBand(0);
+
+    if (bands_.size() > 1) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [&] { return pending_ == 0; });
+    }
+
+    if (format_ == FRAME_NV21_ROT90) {
+        for (int r = 0; r < rows; r++) {
+            rowCount_[r] = 0;
+            rowSumX_[r] = 0;
+            for (const Band &band : bands_) {
+                rowCount_[r] += band.rowCount[r];
+                rowSumX_[r] += band.rowSumX[r];
+            }
+            res.count += rowCount_[r];
+            res.sumX += rowSumX_[r];
+        }
+    } else {
+        for (const Band &band : bands_) {
+            res.count += band.count;
+            res.sumX += band.sumX;
+        }
+    }
+
+    // only use the data if there were a few pixels identified
+    if (res.count >= 2) {
+        res.com = (int) (res.sumX / res.count);
+    }
+    return res;
+}
+
+LineModel LineDetector::fit(int rowsPerBand) const {
+    LineModel m = {false, 0, 0, 0, 0, 0};
+    if (rowsPerBand < 1) {
+        rowsPerBand = 1;
+    }
+
+    // weighted least squares on the band centroids, weight = line pixels in
+    // the band. d is scaled to [0, 1] over the scanned span to keep the
+    // normal equations well conditioned.
+    double span = rows_ > 1 ? (double) (rows_ - 1) * params_.rowStep : 1.0;
+    // centroid column x and scaled distance t of the band starting at scanned row k0
+    auto centroid = [&](int k0, int &count, double &x, double &t) {
+        long long sumX = 0;
+        double sumD = 0;
+        count = 0;
+        for (int k = k0; k < k0 + rowsPerBand && k < rows_; k++) {
+            count += rowCount_[k];
+            sumX += rowSumX_[k];
+            sumD += (double) rowCount_[k] * (rows_ - 1 - k) * params_.rowStep;
+        }
+        if (count > 0) {
+            x = (double) sumX / count;
+            t = sumD / count / span;
+        }
+    };
+
+    double S[5] = {0, 0, 0, 0, 0};  // sum of w*t^i
+    double B[3] = {0, 0, 0};        // sum of w*x*t^i
+    for (int k0 = 0; k0 < rows_; k0 += rowsPerBand) {
+        int count;
+        double x = 0, t = 0;
+        centroid(k0, count, x, t);
+        if (count < 2) {
+            continue;
+        }
+        double w = count;
+        double tp = 1;
+        for (int i = 0; i < 5; i++) {
+            S[i] += w * tp;
+            if (i < 3) {
+                B[i] += w * x * tp;
+            }
+            tp *= t;
+        }
+        m.bands++;
+    }
+
+    if (m.bands < 2) {
+        return m;
+    }
+
+    double a = 0, b = 0, c = 0;
+    if (m.bands >= 3) {
+        // solve [S0 S1 S2; S1 S2 S3; S2 S3 S4] [a b c]' = B by Cramer's rule
+        double det = S[0] * (S[2] * S[4] - S[3] * S[3])
+                   - S[1] * (S[1] * S[4] - S[3] * S[2])
+                   + S[2] * (S[1] * S[3] - S[2] * S[2]);
+        if (det > 1e-9 * S[0] * S[0] * S[0]) {
+            a = (B[0] * (S[2] * S[4] - S[3] * S[3])
+               - S[1] * (B[1] * S[4] - S[3] * B[2])
+               + S[2] * (B[1] * S[3] - S[2] * B[2])) / det;
+            b = (S[0] * (B[1] * S[4] - B[2] * S[3])
+               - B[0] * (S[1] * S[4] - S[3] * S[2])
+               + S[2] * (S[1] * B[2] - B[1] * S[2])) / det;
+            c = (S[0] * (S[2] * B[2] - S[3] * B[1])
+               - S[1] * (S[1] * B[2] - B[1] * S[2])
+               + B[0] * (S[1] * S[3] - S[2] * S[2])) / det;
+            m.valid = true;
+        }
+    }
+    if (!m.valid) {
+        // two bands (or bands in a degenerate layout): straight line only
+        double det = S[0] * S[2] - S[1] * S[1];
+        if (det <= 1e-9 * S[0] * S[0]) {
+            return m;
+        }
+        a = (B[0] * S[2] - S[1] * B[1]) / det;
+        b = (S[0] * B[1] - S[1] * B[0]) / det;
+        m.valid = true;
+    }
+
+    m.position = (float) a;
+    m.heading = (float) (b / span);
+    m.curvature = (float) (c / (span * span));
+
+    double sq = 0;
+    for (int k0 = 0; k0 < rows_; k0 += rowsPerBand) {
+        int count;
+        double x = 0, t = 0;
+        centroid(k0, count, x, t);
+        if (count >= 2) {
+            double e = x - (a + b * t + c * t * t);
+            sq += count * e * e;
+        }
+    }
+    m.rms = (float) std::sqrt(sq / S[0]);
+    return m;
+}
+
+LineTracker::LineTracker(LineDetector &detector, int rowsPerBand, int halfWidth, int minConfidence)
+    : detector_(detector), rowsPerBand_(rowsPerBand > 0 ? rowsPerBand : 1),
+      halfWidth_(halfWidth > 0 ? halfWidth : 1), minConfidence_(minConfidence),
+      history_(0), params_() {
+}
+
+// share of the bands that saw the line, scaled down as the centroids stray from the curve
+int LineTracker::confidence(const LineModel &m, int rows) const {
+    if (!m.valid || rows == 0) {
+        return 0;
+    }
+    int bands = (rows + rowsPerBand_ - 1) / rowsPerBand_;
+    return (int) lroundf(100.0f * m.bands / bands * halfWidth_ / (halfWidth_ + m.rms));
+}
+
+Track LineTracker::detectNV21(const uint8_t *nv21, int width, int height, bool rotate90,
+                              const Params &p) {
+    int rowWidth = rotate90 ? height : width;
+    int outHeight = rotate90 ? width : height;
+    int rowEnd = p.rowEnd < outHeight ? p.rowEnd : outHeight;
+    int step = p.rowStep > 0 ? p.rowStep : 1;
+    int rows = rowEnd > p.rowStart ? (rowEnd - p.rowStart + step - 1) / step : 0;
+
+    if (p.rowStart != params_.rowStart || p.rowEnd != params_.rowEnd || step != params_.rowStep) {
+        history_ = 0;  // the history was measured on other rows
+        params_ = p;
+        params_.rowStep = step;
+    }
+
+    window_.clear();
+    if (history_ > 0) {
+        // predict this frame's line assuming it keeps moving as it did over the last two frames
+        LineModel pred = last_[0];
+        if (history_ > 1) {
+            pred.position += last_[0].position - last_[1].position;
+            pred.heading += last_[0].heading - last_[1].heading;
+        }
+        window_.resize(rows);
+        for (int k = 0; k < rows; k++) {
+            float x = pred.at((float) (rows - 1 - k) * step);
+            x = std::max(-1.0f, std::min((float) rowWidth, x));
+            window_[k].lo = (int) std::floor(x) - halfWidth_;
+            window_[k].hi = (int) std::ceil(x) + halfWidth_ + 1;
+        }
+    }
+
+    Track tr;
+    detector_.setWindow(window_);
+    tr.result = detector_.detectNV21(nv21, width, height, rotate90, p);
+    tr.model = detector_.fit(rowsPerBand_);
+    tr.confidence = confidence(tr.model, rows);
+    tr.windowed = !window_.empty();
+
+    if (tr.windowed && tr.confidence < minConfidence_) {
+        // lost inside the window, scan the whole rows again right away
+        int scanned = tr.result.scanned;
+        window_.clear();
+        detector_.setWindow(window_);
+        tr.result = detector_.detectNV21(nv21, width, height, rotate90, p);
+        tr.result.scanned += scanned;
+        tr.model = detector_.fit(rowsPerBand_);
+        tr.confidence = confidence(tr.model, rows);
+        tr.windowed = false;
+    }
+    window_.clear();
+    detector_.setWindow(window_);
+
+    if (tr.confidence >= minConfidence_) {
+        last_[1] = last_[0];
+        last_[0] = tr.model;
+        // after a full scan the line may have jumped, so don't take a rate from it
+        history_ = tr.windowed ? std::min(history_ + 1, 2) : 1;
+    } else {
+        history_ = 0;
+    }
+    return tr;
+}
+
+} // namespace linedetect
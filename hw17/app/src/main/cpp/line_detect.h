@@ -0,0 +1,170 @@
+// Line detection kernel for the robot camera
+// finds the column center of mass of the line pixels in a band of rows,
+// same test as the old Java loop in MainActivity.onSurfaceTextureUpdated,
+// on either RGB pixels or the camera's YUV preview frames
+
+#ifndef LINE_DETECT_H__
+#define LINE_DETECT_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace linedetect {
+
+// where the channels sit in one 32 bit pixel
+enum PixelOrder {
+    ORDER_ARGB,   // Java int colors (Bitmap.getPixels), 0xAARRGGBB
+    ORDER_RGBA    // Android bitmap memory (AndroidBitmap_lockPixels), bytes R,G,B,A
+};
+
+// what the frame handed to the detector looks like
+enum FrameFormat {
+    FRAME_RGB32,        // 32 bit pixels, see PixelOrder
+    FRAME_NV21,         // camera preview: Y plane, then interleaved V,U at half resolution
+    FRAME_NV21_ROT90    // NV21, scanned as if rotated 90 degrees clockwise (setDisplayOrientation(90))
+};
+
+struct Params {
+    int R;          // color variance: -R < red - (green+blue)/2 < R
+    int T;          // brightness threshold: red > T
+    int rowStart;   // first row scanned
+    int rowEnd;     // scan up to (not including) this row
+    int rowStep;    // scan every rowStep-th row
+};
+
+struct Result {
+    int com;        // column center of mass, 0 if fewer than 2 line pixels were found
+    int count;      // number of line pixels
+    long long sumX; // sum of the columns of the line pixels
+    int scanned;    // pixels tested
+};
+
+// columns [lo, hi) of one scanned row
+struct Span {
+    int lo;
+    int hi;
+};
+
+// Quadratic fit of the line through the per-band centroids, in terms of
+// d = rows ahead of the nearest scanned row (rows further down the image are
+// closer to the robot): column(d) = position + heading*d + curvature*d*d
+struct LineModel {
+    bool valid;         // false if fewer than 2 bands saw the line
+    int bands;          // bands that had line pixels
+    float position;     // column of the line at the nearest scanned row
+    float heading;      // columns per row ahead
+    float curvature;    // columns per row ahead, squared
+    float rms;          // pixel weighted rms distance of the band centroids from the curve
+
+    float at(float d) const { return position + heading * d + curvature * d * d; }
+};
+
+// Splits the scanned rows into bands, one per thread. The worker threads are
+// started once and reused for every frame, so a frame only costs a wake-up.
+class LineDetector {
+public:
+    explicit LineDetector(int threads);
+    ~LineDetector();
+
+    Result detect(const uint32_t *pixels, int width, int height, int stride,
+                  PixelOrder order, const Params &p);
+    // width and height are the camera frame's; with rotate90 the rows and
+    // columns in p and the result are those of the rotated (height wide) image
+    Result detectNV21(const uint8_t *nv21, int width, int height, bool rotate90,
+                      const Params &p);
+    int threads() const { return (int) bands_.size(); }
+
+    // only scan columns [window[k].lo, window[k].hi) of scanned row k in the
+    // following detect calls, an empty window scans the whole rows again
+    void setWindow(const std::vector<Span> &window) { window_ = window; }
+
+    // fit the line model to the rows of the last detect(), grouping
+    // rowsPerBand scanned rows into each centroid
+    LineModel fit(int rowsPerBand) const;
+
+private:
+    struct Band {
+        int k0, k1;       // scanned row indices [k0, k1) handled by this band
+                          // (frame rows for FRAME_NV21_ROT90)
+        int count;
+        long long sumX;
+        std::vector<int> rowCount;       // FRAME_NV21_ROT90: per scanned row sums of this band
+        std::vector<int> rowSumX;        // (a frame's height squared at most)
+        std::vector<uint8_t> y, v;       // FRAME_NV21_ROT90: one frame row's pixels of the scanned rows
+    };
+
+    Result run(int rows);
+    void worker(int id);
+    void runBand(int id);
+    void runBandRot90(Band &band);
+
+    std::vector<std::thread> workers_;
+    std::vector<Band> bands_;
+    std::vector<int> rowCount_;       // line pixels in each scanned row
+    std::vector<long long> rowSumX_;  // column sum of the line pixels in each scanned row
+    int rows_;                        // scanned rows in the last detect()
+    std::vector<Span> window_;        // per scanned row column window, empty = whole rows
+    std::vector<Span> spans_;         // window_ clipped to the frame being processed
+    int ys0_;                         // FRAME_NV21_ROT90: first frame row the windows touch
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    unsigned generation_;
+    int pending_;
+    bool quit_;
+
+    // the frame being processed
+    FrameFormat format_;
+    const uint32_t *pixels_;
+    const uint8_t *nv21_;
+    int width_;
+    int height_;
+    int stride_;
+    PixelOrder order_;
+    Params params_;
+};
+
+// Follows the line from frame to frame: each frame is scanned only in a
+// window around where the last frames' curves predict the line to be, and
+// the whole rows are scanned again as soon as the line is lost there.
+struct Track {
+    Result result;
+    LineModel model;
+    bool windowed;      // the line was found inside the window (no full scan this frame)
+    int confidence;     // 0-100, from the share of bands that saw the line and the fit residual
+};
+
+class LineTracker {
+public:
+    // halfWidth: columns searched on either side of the predicted line
+    // minConfidence: below this the line counts as lost and the next frame is scanned in full
+    LineTracker(LineDetector &detector, int rowsPerBand, int halfWidth, int minConfidence);
+
+    Track detectNV21(const uint8_t *nv21, int width, int height, bool rotate90, const Params &p);
+    void reset() { history_ = 0; }
+
+private:
+    int confidence(const LineModel &m, int rows) const;
+
+    LineDetector &detector_;
+    int rowsPerBand_;
+    int halfWidth_;
+    int minConfidence_;
+    LineModel last_[2];     // the last two tracked models, newest first
+    int history_;           // number of valid entries in last_
+    Params params_;         // rows the history was measured on
+    std::vector<Span> window_;
+};
+
+// count and column sum of the line pixels in one row, no threading
+void scanRow(const uint32_t *row, int width, PixelOrder order, int R, int T,
+             int &count, long long &sumX);
+void scanRowNV21(const uint8_t *yRow, const uint8_t *vuRow, int width, int R, int T,
+                 int &count, long long &sumX);
+
+} // namespace linedetect
+
+#endif
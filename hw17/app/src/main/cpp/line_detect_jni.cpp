@@ -0,0 +1,69 @@
+// JNI binding for the line detection kernel
+// reads the camera's NV21 preview buffer in place, so the frame is never
+// converted to an RGB bitmap or copied
+
+#include <algorithm>
+#include <cmath>
+#include <jni.h>
+
+#include "line_detect.h"
+
+static linedetect::LineDetector &detector() {
+    // a few threads are plenty for 80 rows, more just costs wake-ups
+    static linedetect::LineDetector d(
+            std::max(1, std::min(4, (int) std::thread::hardware_concurrency())));
+    return d;
+}
+
+// scanned rows grouped into each centroid of the line model (6 x every 5th row = 30 rows)
+#define ROWS_PER_BAND 6
+// columns searched either side of where the line is expected (the line is ~30 columns wide)
+#define TRACK_HALF_WIDTH 40
+// below this the line counts as lost and the next frame scans whole rows
+#define TRACK_MIN_CONFIDENCE 40
+
+static linedetect::LineTracker &tracker() {
+    static linedetect::LineTracker t(detector(), ROWS_PER_BAND, TRACK_HALF_WIDTH, TRACK_MIN_CONFIDENCE);
+    return t;
+}
+
+// Finds the line in a preview frame rotated to portrait like the display
+// (setDisplayOrientation(90)), so rows and columns are those of a
+// height wide, width tall image. Only a window around the line found in the
+// last frames is scanned while the line is tracked.
+// out[] = {com, valid, position, heading, curvature, bands, confidence, windowed}
+// heading is in columns per 100 rows ahead, curvature is the columns the
+// quadratic term adds 100 rows ahead, so the PIC can stay in integers
+extern "C" JNIEXPORT jboolean JNICALL
+Java_com_example_xman_robotusbcamera_MainActivity_nativeDetectLine(
+        JNIEnv *env, jclass, jbyteArray frame, jint width, jint height, jint R, jint T,
+        jint rowStart, jint rowEnd, jint rowStep, jintArray out) {
+    if (env->GetArrayLength(out) < 8 ||
+        env->GetArrayLength(frame) < width * height * 3 / 2) {
+        return JNI_FALSE;
+    }
+
+    void *nv21 = env->GetPrimitiveArrayCritical(frame, nullptr);
+    if (nv21 == nullptr) {
+        return JNI_FALSE;
+    }
+
+    linedetect::Params p = {R, T, rowStart, rowEnd, rowStep};
+    linedetect::Track tr = tracker().detectNV21((const uint8_t *) nv21, width, height, true, p);
+
+    env->ReleasePrimitiveArrayCritical(frame, nv21, JNI_ABORT);  // read only, nothing to copy back
+
+    const linedetect::LineModel &m = tr.model;
+    jint vals[8] = {
+            tr.result.com,
+            m.valid ? 1 : 0,
+            (jint) lroundf(m.position),
+            (jint) lroundf(m.heading * 100.0f),
+            (jint) lroundf(m.curvature * 10000.0f),
+            m.bands,
+            tr.confidence,
+            tr.windowed ? 1 : 0
+    };
+    env->SetIntArrayRegion(out, 0, 8, vals);
+    return m.valid ? JNI_TRUE : JNI_FALSE;
+}
@@ -5,8 +5,8 @@ import android.app.PendingIntent;
 import android.content.Context;
 import android.content.Intent;
 import android.content.pm.PackageManager;
-import android.graphics.Bitmap;
 import android.graphics.Canvas;
+import android.graphics.Color;
 import android.graphics.Paint;
 import android.graphics.SurfaceTexture;
 import android.hardware.Camera;
@@ -34,25 +34,39 @@ import java.util.List;
 import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 
-import static android.graphics.Color.green;
-import static android.graphics.Color.red;
-import static android.graphics.Color.blue;
-import static android.graphics.Color.rgb;
-
-public class MainActivity extends AppCompatActivity implements TextureView.SurfaceTextureListener {
+public class MainActivity extends AppCompatActivity
+        implements TextureView.SurfaceTextureListener, Camera.PreviewCallback {
     /* Camera Global Variables */
     private Camera mCamera;
     private TextureView mTextureView;
     private SurfaceView mSurfaceView;
     private SurfaceHolder mSurfaceHolder;
-    private Bitmap bmp = Bitmap.createBitmap(640, 480, Bitmap.Config.ARGB_8888);
-    private Canvas canvas = new Canvas(bmp);
     private Paint paint1 = new Paint();
     private TextView mTextView;
     SeekBar myControlR;            // for R control (color variance)
     SeekBar myControlT;           // for T control (brightness threshold)
     static long prevtime = 0;     // for FPS calculation
 
+    /* Native line detection (src/main/cpp) */
+    static {
+        System.loadLibrary("linedetect");
+    }
+    // finds the line pixels in rows [rowStart, rowEnd), every rowStep-th row, of the NV21 preview frame
+    // rotated to portrait (480 wide, 640 tall) and fits a curve through them; while the line is tracked
+    // only a window around it is scanned
+    // line[] = {COM, valid, position, heading, curvature, bands, confidence (0-100), windowed},
+    // returns true if the curve fit is valid
+    private static native boolean nativeDetectLine(byte[] frame, int width, int height, int R, int T,
+                                                   int rowStart, int rowEnd, int rowStep, int[] line);
+    private int[] line = new int[8];
+
+    // preview frame size; the views are 640x480 px, so a portrait pixel (x, y) is drawn at (x*4/3, y*3/4)
+    private static final int FRAME_W = 640;
+    private static final int FRAME_H = 480;
+    // rows 100 to 400 of the view, in portrait image rows
+    private static final int ROW_START = 100 * FRAME_W / FRAME_H;
+    private static final int ROW_END = 400 * FRAME_W / FRAME_H;
+
     /* USB Global Variables */
     private UsbManager manager;
     private UsbSerialPort sPort;
@@ -102,6 +116,13 @@ public class MainActivity extends AppCompatActivity implements TextureView.Surfa
         mCamera.setParameters(parameters);
         mCamera.setDisplayOrientation(90); // rotate to portrait mode
 
+        // analyze the NV21 preview frames directly instead of reading back the displayed texture;
+        // two buffers so the camera can fill one while the other is being processed
+        int frameBytes = FRAME_W * FRAME_H * 3 / 2;
+        mCamera.addCallbackBuffer(new byte[frameBytes]);
+        mCamera.addCallbackBuffer(new byte[frameBytes]);
+        mCamera.setPreviewCallbackWithBuffer(this);
+
         try {
             mCamera.setPreviewTexture(surface);
             mCamera.startPreview();
@@ -115,66 +136,69 @@ public class MainActivity extends AppCompatActivity implements TextureView.Surfa
     }
 
     public boolean onSurfaceTextureDestroyed(SurfaceTexture surface) {
+        mCamera.setPreviewCallbackWithBuffer(null);
         mCamera.stopPreview();
         mCamera.release();
         return true;
     }
 
-    // the important function
     public void onSurfaceTextureUpdated(SurfaceTexture surface) {
+        // the preview is only displayed, the frames are analyzed in onPreviewFrame
+    }
+
+    // the important function
+    public void onPreviewFrame(byte[] data, Camera camera) {
         // every time there is a new Camera preview frame
-        mTextureView.getBitmap(bmp);
-        int COM = 0;  // robot center of mass (based on pixels)
+        int R = myControlR.getProgress(); // setting R (color variance)
+        int T = myControlT.getProgress(); // setting T (brightness threshold)
+
+        // look at every 5th row of the view from 100 to 400, done natively on the Y and V planes
+        boolean valid = nativeDetectLine(data, FRAME_W, FRAME_H, R, T, ROW_START, ROW_END, 5, line);
+        int COM = line[0];  // robot center of mass (based on pixels)
+        camera.addCallbackBuffer(data); // hand the buffer back for the next frame
+
+        // send data to PIC: position of the line closest to the robot, heading and curvature
+        // (without a curve fit, fall back to the COM and no lookahead)
+        String sendString;
+        if (valid) {
+            sendString = line[2] + " " + line[3] + " " + line[4] + '\n';
+        } else {
+            sendString = COM + " 0 0\n";
+        }
+        if (sPort != null) {
+            try {
+                sPort.write(sendString.getBytes(), 10); // 10 is the timeout
+            } catch (IOException e) { }
+        }
 
         final Canvas c = mSurfaceHolder.lockCanvas();
         if (c != null) {
-            int R = myControlR.getProgress(); // setting R (color variance)
-            int T = myControlT.getProgress(); // setting T (brightness threshold)
-            int[] pixels = new int[bmp.getWidth()]; // pixels[] is the RGBA data
-            int sum_mr = 0; // the sum of the mass times the radius
-            int sum_m = 0; // the sum of the masses
-
-            // nested for loops for the image - looking at every 5th row
-            for (int startY = 100; startY < 400; startY += 5) {
-                // get pixel data from the row
-                bmp.getPixels(pixels, 0, bmp.getWidth(), 0, startY, bmp.getWidth(), 1);
-                for (int i = 0; i < bmp.getWidth(); i++) {
-                    if ( (red(pixels[i]) - ((green(pixels[i])+blue(pixels[i]))/2) > -R) && (red(pixels[i]) - ((green(pixels[i])+blue(pixels[i]))/2) < R) && (red(pixels[i])  > T)) {
-                        pixels[i] = rgb(1, 1, 1); // set the pixel to almost 100% black
-
-                        sum_m = sum_m + green(pixels[i])+red(pixels[i])+blue(pixels[i]);
-                        sum_mr = sum_mr + (green(pixels[i])+red(pixels[i])+blue(pixels[i]))*i;
-                    }
-                }
-            }
+            c.drawColor(Color.BLACK);
 
-            // only use the data if there were a few pixels identified, otherwise you might get a divide by 0 error
-            if(sum_m>5){
-                COM = sum_mr / sum_m;
-            }
-            else{
-                COM = 0;
+            // draw a dot at the COM
+            c.drawCircle(COM * FRAME_W / FRAME_H, 240, 5, paint1); // x position, y position, diameter, color
+
+            // draw the fitted line every 40 rows, d = rows ahead of the bottom scanned row
+            if (valid) {
+                int bottom = ROW_START + (ROW_END - 1 - ROW_START) / 5 * 5;
+                for (int d = 0; d < ROW_END - ROW_START; d += 40) {
+                    float x = line[2] + line[3] * d / 100.0f + line[4] * d * d / 10000.0f;
+                    c.drawCircle(x * FRAME_W / FRAME_H, (bottom - d) * FRAME_H / FRAME_W, 2, paint1);
+                }
             }
 
-            // send data to PIC
-            String sendString = String.valueOf(COM) + '\n';
-            try {
-                sPort.write(sendString.getBytes(), 10); // 10 is the timeout
-            } catch (IOException e) { }
+            // write the COM as text (next to dot)
+            c.drawText("pos = " + COM, 10, 200, paint1);
+            c.drawText("confidence = " + line[6] + (line[7] == 1 ? " (tracking)" : ""), 10, 230, paint1);
+            mSurfaceHolder.unlockCanvasAndPost(c);
         }
 
-        // draw a dot at the COM
-        canvas.drawCircle(COM, 240, 5, paint1); // x position, y position, diameter, color
-
-        // write the COM as text (next to dot)
-        canvas.drawText("pos = " + COM, 10, 200, paint1);
-        c.drawBitmap(bmp, 0, 0, null);
-        mSurfaceHolder.unlockCanvasAndPost(c);
-
         // calculate the FPS to see how fast the code is running
         long nowtime = System.currentTimeMillis();
         long diff = nowtime - prevtime;
-        mTextView.setText("FPS =  " + 1000 / diff);
+        if (diff > 0) {
+            mTextView.setText("FPS =  " + 1000 / diff);
+        }
         prevtime = nowtime;
     }
 
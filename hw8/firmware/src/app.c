@@ -45,7 +45,6 @@ APP_DATA appData;
 
 
 /* TODO:  Add any necessary local functions. */
-#define LSM6DS33 0b1101011
 
 
 // *****************************************************************************
@@ -74,7 +73,10 @@ void APP_Initialize ( void )
     INTCONbits.MVEC = 0x1;                                       // enable multi vector interrupts
     DDPCONbits.JTAGEN = 0;                                       // disable JTAG to get pins back
     i2c_master_setup();                                          // set up I2C2 as master, at 400 kHz
-    IMU_init();                                                  // initialize LSM6DS33
+    lsm6ds33_setup();                                            // initialize LSM6DS33:
+    lsm6ds33_accel(LSM6DS33_ODR_1660HZ, LSM6DS33_XL_2G, LSM6DS33_XL_BW_100HZ); // 1.66 kHz, 2 g, 100 Hz LPF
+    lsm6ds33_gyro(LSM6DS33_ODR_1660HZ, LSM6DS33_G_1000DPS);     // 1.66 kHz, 1000 dps
+    lsm6ds33_flush();                                            // all registers, in burst writes
     LCD_init();                                                  // initialize LCD/SPI communication
     TRISAbits.TRISA4 = 0;                                        // set up green LED heartbeat check
     LATAbits.LATA4 = 0;   
@@ -88,14 +90,7 @@ void APP_Initialize ( void )
     
     // IMU WHOAMI check
     char lcd[30];
-    i2c_master_start();
-    i2c_master_send((LSM6DS33 << 1) | 0); // notify via write
-    i2c_master_send(0x0F); // WHOAMI register
-    i2c_master_restart();
-    i2c_master_send((LSM6DS33 << 1) | 1); // master is reading
-    int whoami = (int) i2c_master_recv();
-    i2c_master_ack(1);
-    i2c_master_stop();
+    int whoami = lsm6ds33_who_am_i();
     sprintf(lcd,"WHOAMI = %d",whoami);
     drawString(10,10,lcd,WHITE,BLACK);
 }
@@ -131,7 +126,7 @@ void APP_Tasks ( void )
             char lcd[30];
             
             // get data and convert to shorts
-            i2c_read_multiple(LSM6DS33,0x20,imudata,14); // 0x20 = temp_L register
+            lsm6ds33_read(LSM6DS33_OUT_TEMP_L,imudata,14); // temperature, then gyro and accelerometer
             signed short temperature = (imudata[1] << 8) | imudata[0];   
             signed short gyroX = (imudata[3] << 8) | imudata[2];   
             signed short gyroY = (imudata[5] << 8) | imudata[4];   
@@ -175,49 +170,6 @@ void APP_Tasks ( void )
     }
 }
 
-/* Other Standalone Helper Functions */
-void IMU_init() {
-    // accelerometer init: 1.66 kHz sample rate, 2g sensitivity, 100 Hz anti-aliasing LPF
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x10); // CTRL1_XL register 
-    i2c_master_send(0b10000010);
-    i2c_master_stop();
-    
-    // gyroscope init: 1.66 kHz sample rate, 1000 dps sensitivity
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x11); // CTRL2_G register 
-    i2c_master_send(0b10001000);
-    i2c_master_stop();
-    
-    // CTRL3_C: make IF_INC = 1 to read multiple registers in a row w/o specifying every address
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x12); // CTRL3_C register 
-    i2c_master_send(0b00000100);
-    i2c_master_stop();
-}
-
-void i2c_read_multiple(unsigned char address, unsigned char reg, unsigned char *data, int length) {
-    // set register to read from 
-    i2c_master_start();
-    i2c_master_send((address << 1) | 0); // notify via write
-    i2c_master_send(reg); // 
-    i2c_master_restart();
-    
-    // loop to get all data
-    int i = 0;
-    i2c_master_send((address << 1) | 1); // master is reading
-    for (i = 0; i <= length-1; i++) {
-        data[i] = i2c_master_recv();
-        if (i < length-1) {
-            i2c_master_ack(0);      // not done getting all the data
-        } else {i2c_master_ack(1);} // done getting all data    
-    }
-    i2c_master_stop();
-}
- 
 
 /*******************************************************************************
  End of File
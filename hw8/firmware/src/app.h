@@ -15,6 +15,7 @@
 #include "system_definitions.h"
 #include "ST7735.h"
 #include "i2c_master_noint.h"
+#include "lsm6ds33.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -156,10 +157,6 @@ void APP_Initialize ( void );
 void APP_Tasks( void );
 
 
-/* Other Standalone Helper Function Prototypes */
-void IMU_init(void); // initialize IMU accelerometer, gyroscope, multi-reader (includes temp)
-void i2c_read_multiple(unsigned char, unsigned char, unsigned char *, int); 
-
 
 #endif /* _APP_H */
 
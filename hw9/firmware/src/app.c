@@ -14,13 +14,13 @@
 // *****************************************************************************
 // *****************************************************************************
 
-#define LSM6DS33 0b1101011
 
 uint8_t APP_MAKE_BUFFER_DMA_READY dataOut[APP_READ_BUFFER_SIZE];
 uint8_t APP_MAKE_BUFFER_DMA_READY readBuffer[APP_READ_BUFFER_SIZE];
 int len, i = 0;
 int dataFlag = 0;  // check for if 'r' was received
 int startTime = 0; // to remember the loop time
+bool lcdReady = false; // LCD initialized, and its first screen drawn
 
 // *****************************************************************************
 /* Application Data
@@ -295,28 +295,15 @@ void APP_Initialize(void) {
     INTCONbits.MVEC = 0x1;                                       // enable multi vector interrupts
     DDPCONbits.JTAGEN = 0;                                       // disable JTAG to get pins back
     i2c_master_setup();                                          // set up I2C2 as master, at 400 kHz
-    IMU_init();                                                  // initialize LSM6DS33
-    LCD_init();                                                  // initialize LCD/SPI communication
+    lsm6ds33_setup();                                            // initialize LSM6DS33:
+    lsm6ds33_accel(LSM6DS33_ODR_1660HZ, LSM6DS33_XL_2G, LSM6DS33_XL_BW_100HZ); // 1.66 kHz, 2 g, 100 Hz LPF
+    lsm6ds33_gyro(LSM6DS33_ODR_1660HZ, LSM6DS33_G_1000DPS);     // 1.66 kHz, 1000 dps
+    lsm6ds33_flush();                                            // all registers, in burst writes
+    LCD_init_start();                                            // initialize LCD/SPI communication, the
+                                                                 // rest is sent from APP_Tasks
     TRISAbits.TRISA4 = 0;                                        // set up green LED heartbeat check
     LATAbits.LATA4 = 0;   
     
-    // setup LCD
-    LCD_clearScreen(BLACK);
-    
-    //IMU WHOAMI check
-    char lcd[30];
-    i2c_master_start();
-    i2c_master_send((LSM6DS33 << 1) | 0); // notify via write
-    i2c_master_send(0x0F); // WHOAMI register
-    i2c_master_restart();
-    i2c_master_send((LSM6DS33 << 1) | 1); // master is reading
-    int whoami = (int) i2c_master_recv();
-    i2c_master_ack(1);
-    i2c_master_stop();
-    sprintf(lcd,"WHOAMI = %d",whoami);
-    drawString(10,10,lcd,WHITE,BLACK);
-    
-    
     /* STARTTIME*/
     startTime = _CP0_GET_COUNT();
 }
@@ -329,6 +316,16 @@ void APP_Initialize(void) {
  */
 
 void APP_Tasks(void) {
+    // the LCD boots (a few hundred ms of waits) alongside USB and the IMU
+    // rather than before them, and is only drawn on once it's done
+    if (!lcdReady && LCD_init_task()) {
+        char lcd[30];
+        LCD_clearScreen(BLACK);
+        sprintf(lcd,"WHOAMI = %d",lsm6ds33_who_am_i());  // IMU WHOAMI check
+        drawString(10,10,lcd,WHITE,BLACK);
+        lcdReady = true;
+    }
+
     /* Update the application state machine based
      * on the current state */
 
@@ -435,7 +432,7 @@ void APP_Tasks(void) {
             char lcd[30];
             
             // get data and convert to shorts
-            i2c_read_multiple(LSM6DS33,0x20,imudata,14); // 0x20 = temp_L register
+            lsm6ds33_read(LSM6DS33_OUT_TEMP_L,imudata,14); // temperature, then gyro and accelerometer
             signed short temperature = (imudata[1] << 8) | imudata[0];   
             signed short gyroX = (imudata[3] << 8) | imudata[2];   
             signed short gyroY = (imudata[5] << 8) | imudata[4];   
@@ -444,13 +441,15 @@ void APP_Tasks(void) {
             signed short accelY = (imudata[11] << 8) | imudata[10]; 
             signed short accelZ = (imudata[13] << 8) | imudata[12]; 
             
-            // print data to LCD
-            sprintf(lcd,"AX = %d   ",accelX);
-            drawString(10,20,lcd,WHITE,BLACK);
-            sprintf(lcd,"AY = %d   ",accelY);
-            drawString(10,30,lcd,WHITE,BLACK);
-            sprintf(lcd,"AZ = %d   ",accelZ);
-            drawString(10,40,lcd,WHITE,BLACK);
+            // print data to LCD, once it's up
+            if (lcdReady) {
+                sprintf(lcd,"AX = %d   ",accelX);
+                drawString(10,20,lcd,WHITE,BLACK);
+                sprintf(lcd,"AY = %d   ",accelY);
+                drawString(10,30,lcd,WHITE,BLACK);
+                sprintf(lcd,"AZ = %d   ",accelZ);
+                drawString(10,40,lcd,WHITE,BLACK);
+            }
             
             // only send data if r is received (dataFlag = 1)
             if (dataFlag == 1) {
@@ -503,47 +502,6 @@ void APP_Tasks(void) {
     }
 }
 
-void IMU_init() {
-    // accelerometer init: 1.66 kHz sample rate, 2g sensitivity, 100 Hz anti-aliasing LPF
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x10); // CTRL1_XL register 
-    i2c_master_send(0b10000010);
-    i2c_master_stop();
-    
-    // gyroscope init: 1.66 kHz sample rate, 1000 dps sensitivity
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x11); // CTRL2_G register 
-    i2c_master_send(0b10001000);
-    i2c_master_stop();
-    
-    // CTRL3_C: make IF_INC = 1 to read multiple registers in a row w/o specifying every address
-    i2c_master_start();
-    i2c_master_send((0b1101011 << 1) | 0); // chip address
-    i2c_master_send(0x12); // CTRL3_C register 
-    i2c_master_send(0b00000100);
-    i2c_master_stop();
-}
-
-void i2c_read_multiple(unsigned char address, unsigned char reg, unsigned char *data, int length) {
-    // set register to read from 
-    i2c_master_start();
-    i2c_master_send((address << 1) | 0); // notify via write
-    i2c_master_send(reg); // 
-    i2c_master_restart();
-    
-    // loop to get all data
-    int i = 0;
-    i2c_master_send((address << 1) | 1); // master is reading
-    for (i = 0; i <= length-1; i++) {
-        data[i] = i2c_master_recv();
-        if (i < length-1) {
-            i2c_master_ack(0);      // not done getting all the data
-        } else {i2c_master_ack(1);} // done getting all data    
-    }
-    i2c_master_stop();
-}
 
 /*******************************************************************************
  End of File
@@ -15,6 +15,7 @@
 #include "system_definitions.h"
 #include "ST7735.h"
 #include "i2c_master_noint.h"
+#include "lsm6ds33.h"
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -188,9 +189,6 @@ void APP_Initialize ( void );
 
 void APP_Tasks( void );
 
-void IMU_init(void);
-void i2c_read_multiple(unsigned char, unsigned char, unsigned char *, int);
-
 #endif /* _APP_H */
 
 //DOM-IGNORE-BEGIN
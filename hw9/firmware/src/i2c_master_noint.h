@@ -1,15 +0,0 @@
-#ifndef I2C_MASTER_NOINT_H__
-#define I2C_MASTER_NOINT_H__
-// Header file for i2c_master_noint.c
-// helps implement use I2C1 as a master without using interrupts
-
-void i2c_master_setup(void);              // set up I2C2 as master, at 400 kHz
-
-void i2c_master_start(void);              // send a START signal
-void i2c_master_restart(void);            // send a RESTART signal
-void i2c_master_send(unsigned char byte); // send a byte (either an address or data)
-unsigned char i2c_master_recv(void);      // receive a byte of data
-void i2c_master_ack(int val);             // send an ACK (0) or NACK (1)
-void i2c_master_stop(void);               // send a stop
-
-#endif
\ No newline at end of file
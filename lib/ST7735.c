@@ -0,0 +1,418 @@
+// functions to operate the ST7735 on the PIC32
+// adapted from https://github.com/sumotoy/TFT_ST7735
+// and https://github.com/adafruit/Adafruit-ST7735-Library
+
+// pin connections (the defaults in lib_config.h):
+// VCC - 3.3V
+// GND - GND
+// CS - B7
+// RESET - 3.3V
+// A0 - B15
+// SDA - A1
+// SCK - B14
+// LED - 3.3V
+
+// B8 is turned into SDI1 but is not used or connected to anything
+
+#include <xc.h>
+#include "ST7735.h"
+#include "pins.h"
+
+#define SPI(reg) PERIPH(SPI, LCD_SPI, reg) // a register of the LCD's SPI module
+
+void LCD_SPI_init() {
+  PERIPH(SDI, LCD_SPI, R) = LCD_SDI_INPUT; // SDI pin
+  LCD_SDO_OUTPUT = LCD_SDO_FUNCTION; // SDO pin
+  PIN_OUTPUT(LCD_CS_PORT, LCD_CS_BIT); // CS
+  PIN_HIGH(LCD_CS_PORT, LCD_CS_BIT); // CS starts high
+
+  // A0 / DAT pin
+  PIN_DIGITAL(LCD_A0_PORT, LCD_A0_BIT);
+  PIN_OUTPUT(LCD_A0_PORT, LCD_A0_BIT);
+  PIN_LOW(LCD_A0_PORT, LCD_A0_BIT);
+
+  SPI(CON) = 0; // turn off the spi module and reset it
+  SPI(BUF); // clear the rx buffer by reading from it
+  SPI(BRG) = LCD_SPI_BRG; // baud rate, 12 MHz by default [SPIxBRG = (48000000/(2*desired))-1]
+  SPI(STATbits).SPIROV = 0; // clear the overflow bit
+  SPI(CONbits).CKE = 1; // data changes when clock goes from hi to lo (since CKP is 0)
+  SPI(CONbits).MSTEN = 1; // master operation
+  SPI(CONbits).ON = 1; // turn on spi
+}
+
+unsigned char spi_io(unsigned char o) {
+  SPI(BUF) = o;
+  while(!SPI(STATbits).SPIRBF) { // wait to receive the byte
+    ;
+  }
+  return SPI(BUF);
+}
+
+void LCD_command(unsigned char com) {
+    PIN_LOW(LCD_A0_PORT, LCD_A0_BIT); // DAT
+    PIN_LOW(LCD_CS_PORT, LCD_CS_BIT); // CS
+    spi_io(com);
+    PIN_HIGH(LCD_CS_PORT, LCD_CS_BIT); // CS
+}
+
+void LCD_data(unsigned char dat) {
+    PIN_HIGH(LCD_A0_PORT, LCD_A0_BIT); // DAT
+    PIN_LOW(LCD_CS_PORT, LCD_CS_BIT); // CS
+    spi_io(dat);
+    PIN_HIGH(LCD_CS_PORT, LCD_CS_BIT); // CS
+}
+
+void LCD_data16(unsigned short dat) {
+    PIN_HIGH(LCD_A0_PORT, LCD_A0_BIT); // DAT
+    PIN_LOW(LCD_CS_PORT, LCD_CS_BIT); // CS
+    spi_io(dat>>8);
+    spi_io(dat);
+    PIN_HIGH(LCD_CS_PORT, LCD_CS_BIT); // CS
+}
+
+// What differs between the panels sold with an ST7735: where the glass sits
+// in the controller's 132x162 memory, and the order its subpixels are wired in
+#if LCD_PANEL == LCD_GREEN_TAB
+#define COL_OFFSET 2
+#if LCD_HEIGHT == 128
+#define ROW_OFFSET 3
+#else
+#define ROW_OFFSET 1
+#endif
+#define COLOR_ORDER MADCTL_BGR
+#elif LCD_PANEL == LCD_RED_TAB
+#define COL_OFFSET 0
+#define ROW_OFFSET 0
+#define COLOR_ORDER MADCTL_BGR
+#elif LCD_PANEL == LCD_BLACK_TAB
+#define COL_OFFSET 0
+#define ROW_OFFSET 0
+#define COLOR_ORDER MADCTL_RGB
+#else
+#error "LCD_PANEL should be LCD_GREEN_TAB, LCD_RED_TAB or LCD_BLACK_TAB"
+#endif
+
+// LCD_init's commands, in flash, in order: each is the command, the number
+// of data bytes (with INIT_WAIT if the panel needs time after it), the data,
+// and then the wait in ms. The data sheet asks for 120 ms after SWRESET (150
+// as in the Adafruit library) and 5 ms after SLPOUT; NORON and DISPON keep a
+// short settling wait.
+#define INIT_WAIT 0x80
+
+static const unsigned char initCommands[] = {
+  ST7735_SWRESET, INIT_WAIT, 150,                       // software reset
+  ST7735_SLPOUT, INIT_WAIT, 5,                          // exit sleep
+  ST7735_FRMCTR1, 3, 0x01, 0x2C, 0x2D,                  // frame rate control (normal mode/full colors)
+  ST7735_FRMCTR2, 3, 0x01, 0x2C, 0x2D,                  // (idle mode)
+  ST7735_FRMCTR3, 6, 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D, // (partial mode)
+  ST7735_INVCTR, 1, 0x07,                               // display inversion
+  ST7735_PWCTR1, 3, 0x0A, 0x02, 0x84,                   // 4.30 - 0x0A, 0x05, auto mode
+  ST7735_PWCTR2, 1, 0xC5,
+  ST7735_PWCTR3, 2, 0x0A, 0x00,
+  ST7735_PWCTR4, 2, 0x8A, 0x2A,
+  ST7735_PWCTR5, 2, 0x8A, 0xEE,
+  ST7735_VMCTR1, 1, 0x0E,
+  ST7735_INVOFF, 0,
+  ST7735_COLMOD, 1, 0x05,                               // 16 bit color
+  ST7735_CASET, 4, 0x00, COL_OFFSET, 0x00, COL_OFFSET + _GRAMWIDTH - 1, // the whole panel
+  ST7735_RASET, 4, 0x00, ROW_OFFSET, 0x00, ROW_OFFSET + _GRAMHEIGH - 1,
+  ST7735_GMCTRP1, 16, 0x02, 0x1C, 0x07, 0x12, 0x37, 0x32, 0x29, 0x2D,
+                      0x29, 0x25, 0x2B, 0x39, 0x00, 0x01, 0x03, 0x10,
+  ST7735_GMCTRN1, 16, 0x03, 0x1D, 0x07, 0x06, 0x2E, 0x2C, 0x29, 0x2D,
+                      0x2E, 0x2E, 0x37, 0x3F, 0x00, 0x00, 0x02, 0x10,
+  ST7735_NORON, INIT_WAIT, 10,
+  ST7735_DISPON, INIT_WAIT, 100,
+  ST7735_MADCTL, 1, LCD_MADCTL | COLOR_ORDER,           // rotation
+};
+
+#define TICKS_PER_MS (LIB_SYSCLK / 2 / 1000) // the core timer runs at half SYSCLK
+
+static int initPos = -1;        // the next command in initCommands, -1 before LCD_init_start()
+static unsigned int initStart;  // core timer when the last one was sent
+static unsigned int initWait;   // ticks to wait after it
+
+// a command and its data with CS held low across them, A0 switching in between
+static void LCD_burst(unsigned char com, const unsigned char *dat, int length) {
+  PIN_LOW(LCD_A0_PORT, LCD_A0_BIT); // command
+  PIN_LOW(LCD_CS_PORT, LCD_CS_BIT); // CS
+  spi_io(com);
+  PIN_HIGH(LCD_A0_PORT, LCD_A0_BIT); // data
+  while (length-- > 0) {
+    spi_io(*dat++);
+  }
+  PIN_HIGH(LCD_CS_PORT, LCD_CS_BIT); // CS
+}
+
+void LCD_init_start() {
+  LCD_SPI_init();
+  initPos = 0;
+  initWait = 0;
+}
+
+int LCD_init_task() {
+  const unsigned char *com;
+  int length;
+
+  if (initPos < 0) {
+    return 0;
+  }
+  // send every command whose wait is over, then come back for the rest
+  while (_CP0_GET_COUNT() - initStart >= initWait) {
+    if (initPos == (int) sizeof(initCommands)) {
+      initWait = 0;             // so the timer wrapping can't take it back
+      return 1;
+    }
+    com = &initCommands[initPos];
+    length = com[1] & ~INIT_WAIT;
+    LCD_burst(com[0], com + 2, length);
+    initPos += 2 + length;
+    initStart = _CP0_GET_COUNT();
+    initWait = 0;
+    if (com[1] & INIT_WAIT) {
+      initWait = initCommands[initPos++] * TICKS_PER_MS;
+    }
+  }
+  return 0;
+}
+
+void LCD_init() {
+  LCD_init_start();
+  while (!LCD_init_task()) {
+    ;
+  }
+}
+
+void LCD_drawPixel(unsigned short x, unsigned short y, unsigned short color) {
+  // check boundary
+  LCD_setAddr(x,y,x+1,y+1);
+  LCD_data16(color);
+}
+
+void LCD_setAddr(unsigned short x0, unsigned short y0, unsigned short x1, unsigned short y1) {
+  LCD_command(ST7735_CASET); // Column
+  LCD_data16(x0 + COL_OFFSET);
+	LCD_data16(x1 + COL_OFFSET);
+
+	LCD_command(ST7735_RASET); // Page
+	LCD_data16(y0 + ROW_OFFSET);
+	LCD_data16(y1 + ROW_OFFSET);
+
+	LCD_command(ST7735_RAMWR); // Into RAM
+}
+
+void LCD_clearScreen(unsigned short color) {
+  int i;
+  LCD_setAddr(0,0,_GRAMWIDTH,_GRAMHEIGH);
+	for (i = 0;i < _GRAMSIZE; i++){
+		LCD_data16(color);
+	}
+}
+
+void LCD_pixels(const unsigned short *colors, int n) {
+  PIN_HIGH(LCD_A0_PORT, LCD_A0_BIT); // DAT
+  PIN_LOW(LCD_CS_PORT, LCD_CS_BIT); // CS
+  while (n-- > 0) {
+    spi_io(*colors >> 8);
+    spi_io(*colors++);
+  }
+  PIN_HIGH(LCD_CS_PORT, LCD_CS_BIT); // CS
+}
+
+// Vertical scrolling
+// The controller scrolls its 162 memory rows, as the glass scans them, by
+// showing a band of them from a start row that wraps around the band. With
+// MADCTL_MY the screen's rows are written to memory bottom up, so the band
+// and the direction are turned around here to keep both in screen rows.
+// The screen isn't scrolled with MADCTL_MV, which swaps rows and columns.
+
+#define MEM_ROWS 162
+
+static unsigned short scrollFirst;      // memory row at the start of the band
+static unsigned short scrollHeight;     // rows in it
+
+// the memory row that screen row y is written to
+static unsigned short LCD_memRow(unsigned short y) {
+#if LCD_MADCTL & MADCTL_MY
+  return MEM_ROWS - 1 - ROW_OFFSET - y;
+#else
+  return ROW_OFFSET + y;
+#endif
+}
+
+void LCD_scrollArea(unsigned short y, unsigned short h) {
+  unsigned short first = LCD_memRow(y), last = LCD_memRow(y + h - 1), below;
+  unsigned char dat[6];
+
+  if (last < first) {
+    first = last;
+  }
+  below = MEM_ROWS - first - h;
+  dat[0] = first >> 8;          // top fixed area
+  dat[1] = first;
+  dat[2] = h >> 8;              // scrolling area
+  dat[3] = h;
+  dat[4] = below >> 8;          // bottom fixed area
+  dat[5] = below;
+  LCD_burst(ST7735_VSCRDEF, dat, 6);
+  scrollFirst = first;
+  scrollHeight = h;
+  LCD_scroll(0);
+}
+
+void LCD_scroll(unsigned short lines) {
+  unsigned short start;
+  unsigned char dat[2];
+
+  lines %= scrollHeight;
+#if LCD_MADCTL & MADCTL_MY
+  lines = (scrollHeight - lines) % scrollHeight;
+#endif
+  start = scrollFirst + lines;
+  dat[0] = start >> 8;
+  dat[1] = start;
+  LCD_burst(ST7735_VSCRSADD, dat, 2);
+}
+
+// a character is one window of 5x8 pixels sent in one burst (about 90 bytes),
+// rather than a window and a color for each pixel (about 13 bytes a pixel)
+void drawChar(unsigned short x, unsigned short y, char message, \
+ unsigned short color1, unsigned short color2) { 
+    char row = message - 0x20; // variables for rows and columns of ASCII array
+    unsigned short pixels[5 * 8];
+    int col = 0, j = 0, w = 5, h = 8;
+    
+    if (x >= _GRAMWIDTH || y >= _GRAMHEIGH) { // condition to remain on the screen
+        return;
+    }
+    if (x + w > _GRAMWIDTH) {
+        w = _GRAMWIDTH - x;
+    }
+    if (y + h > _GRAMHEIGH) {
+        h = _GRAMHEIGH - y;
+    }
+    
+    // the window fills a row at a time: character color where the bit is 1, background elsewhere
+    for(j = 0; j < h; j++) {
+        for(col = 0; col < w; col++) {
+            pixels[j * w + col] = ((ASCII[row][col] >> j) & 1) ? color1 : color2;
+        }
+    }
+    LCD_setAddr(x, y, x + w - 1, y + h - 1);
+    LCD_pixels(pixels, w * h);
+}
+
+void drawString(unsigned short x, unsigned short y, char *message, \
+ unsigned short color1, unsigned short color2) {
+    int i = 0;
+    
+    while (message[i]) {
+        drawChar(x+(i*5), y, message[i], color1, color2);
+        i++;
+    }
+}
+
+// Text drawn a few characters at a time
+// LCD_text() only copies a line, and LCD_textTask() draws the lines in the
+// order they came, a few characters a call, so a loop with a deadline (a USB
+// frame, a sample period) can keep text on the screen without stopping for
+// the several ms a few lines take.
+
+#define TEXT_LINES 6
+#define TEXT_LENGTH 26              // a line across the screen, and its 0
+
+typedef struct {
+    unsigned short x, y, color1, color2;
+    char s[TEXT_LENGTH];
+} text_t;
+
+static text_t text[TEXT_LINES];
+static int textLines = 0;           // queued
+static int textLine = 0, textPos = 0; // the next character to draw
+
+int LCD_text(unsigned short x, unsigned short y, const char *message, \
+ unsigned short color1, unsigned short color2) {
+    text_t *t;
+    int i;
+
+    if (textLines == TEXT_LINES) {
+        return 0;
+    }
+    t = &text[textLines];
+    t->x = x;
+    t->y = y;
+    t->color1 = color1;
+    t->color2 = color2;
+    for (i = 0; i < TEXT_LENGTH - 1 && message[i]; i++) {
+        t->s[i] = message[i];
+    }
+    t->s[i] = 0;
+    textLines++;
+    return 1;
+}
+
+int LCD_textBusy(void) {
+    return textLines > 0;
+}
+
+int LCD_textTask(int chars) {
+    while (textLine < textLines && chars > 0) {
+        text_t *t = &text[textLine];
+        if (t->s[textPos] == 0) {
+            textLine++;
+            textPos = 0;
+        } else {
+            drawChar(t->x + textPos * 5, t->y, t->s[textPos], t->color1, t->color2);
+            textPos++;
+            chars--;
+        }
+    }
+    if (textLine < textLines && text[textLine].s[textPos] == 0) {
+        textLine++;                 // finished with the last character
+        textPos = 0;
+    }
+    if (textLine == textLines) {
+        textLine = textLines = 0;
+        return 1;
+    }
+    return 0;
+}
+
+void drawHorizontalProgressBar(unsigned short x, unsigned short y, unsigned short h, unsigned short \
+ barlength, unsigned short len1, unsigned short color1, unsigned short len2, unsigned short color2) {
+    // make progress bar that fills iteratively across
+    int i = 0, j = 0;
+    
+    // this part controls the color that fills the bar (when i = 0, bar is all background)
+    for (j = 0; j <= h; j++) { 
+        for (i = 0; i <= len1; i++) {
+            LCD_drawPixel(x+i,y+j,color1);
+        }
+    }
+    
+    // this part controls the background color
+    for (j = 0; j <= h; j++) {
+        for (i = 0; i <= len2; i++) {
+            LCD_drawPixel((x+barlength)-i,y+j,color2); 
+        }
+    }         
+}
+
+void drawVerticalProgressBar(unsigned short x, unsigned short y, unsigned short len, unsigned short \
+ barlength, unsigned short h1, unsigned short color1, unsigned short h2, unsigned short color2) {
+    // make progress bar that fills iteratively down
+    int i = 0, j = 0;
+    
+    // filling the bar
+    for (i = 0; i <= len; i++) { 
+        for (j = 0; j <= h1; j++) {
+            LCD_drawPixel(x+i,y+j,color1);
+        }
+    }
+    
+    // background color
+    for (i = 0; i <= len; i++) {
+        for (j = 0; j <= h2; j++) {
+            LCD_drawPixel(x+i,(y+barlength)-j,color2); 
+        }
+    }
+}
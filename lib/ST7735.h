@@ -5,6 +5,8 @@
 #ifndef ST7735_H__
 #define ST7735_H__
 
+#include "lib_config.h"
+
 // lookup table for all of the ascii characters
 static const char ASCII[96][5] = {
  {0x00, 0x00, 0x00, 0x00, 0x00} // 20  (space)
@@ -123,8 +125,10 @@ static const char ASCII[96][5] = {
 #define ST7735_RAMWR   0x2C
 #define ST7735_RAMRD   0x2E
 #define ST7735_PTLAR   0x30
+#define ST7735_VSCRDEF 0x33
 #define ST7735_COLMOD  0x3A
 #define ST7735_MADCTL  0x36
+#define ST7735_VSCRSADD 0x37
 #define ST7735_FRMCTR1 0xB1
 #define ST7735_FRMCTR2 0xB2
 #define ST7735_FRMCTR3 0xB3
@@ -153,7 +157,7 @@ static const char ASCII[96][5] = {
 #define MADCTL_MH  0x04
 
 #define _GRAMWIDTH 128
-#define _GRAMHEIGH 160 //128 //160
+#define _GRAMHEIGH LCD_HEIGHT
 #define _GRAMSIZE  _GRAMWIDTH * _GRAMHEIGH
 
 // colors
@@ -170,13 +174,22 @@ unsigned char spi_io(unsigned char); // send and rx a byte over spi
 void LCD_command(unsigned char); // send a command to the LCD
 void LCD_data(unsigned char); // send data to the LCD
 void LCD_data16(unsigned short); // send 16 bit data to the LCD
-void LCD_init(void); // send the initializations to the LCD
+void LCD_init(void); // send the initializations to the LCD, waiting for them (a few hundred ms)
+void LCD_init_start(void); // start sending them without waiting, LCD_init_task() sends the rest
+int LCD_init_task(void); // call until it returns 1, then the LCD can be drawn on
 void LCD_drawPixel(unsigned short, unsigned short, unsigned short); // set the x,y pixel to a color
 void LCD_setAddr(unsigned short, unsigned short, unsigned short, unsigned short); // set the memory address you are writing to
 void LCD_clearScreen(unsigned short); // set the color of every pixel
+void LCD_pixels(const unsigned short *, int); // send colors to the address set by LCD_setAddr, in one burst
+void LCD_scrollArea(unsigned short, unsigned short); // scroll only rows y to y+h-1 (h > 0), not the rest
+void LCD_scroll(unsigned short); // row j of the area shows what was drawn at row (j + lines) % h
 
 void drawString(unsigned short, unsigned short, char *, unsigned short, unsigned short);
 void drawChar(unsigned short, unsigned short, char, unsigned short, unsigned short); 
+int LCD_text(unsigned short, unsigned short, const char *, unsigned short, unsigned short); // queue a
+                         // line for LCD_textTask() (up to 6, 25 characters), returns 0 if full
+int LCD_textBusy(void); // 1 while queued text is still being drawn
+int LCD_textTask(int); // draw up to that many queued characters, returns 1 once all are drawn
 void drawHorizontalProgressBar(unsigned short, unsigned short, unsigned short, unsigned short, \
  unsigned short, unsigned short, unsigned short, unsigned short); // draws bar ACROSS
 void drawVerticalProgressBar(unsigned short, unsigned short, unsigned short, unsigned short, \
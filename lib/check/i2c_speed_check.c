@@ -0,0 +1,59 @@
+// Linux check for the I2C baud rate arithmetic in i2c_master_noint.c
+// runs i2c_master_setup() and i2c_master_speed() against stub registers
+// (xc.h in this directory) and compares the I2CxBRG they write and the rate
+// they report with the values worked out by hand from the data sheet formula,
+// at the default 48 MHz PBCLK. Exits with 1 if anything differs.
+//
+// build and run from lib/:
+//   cc -I check -I . check/i2c_speed_check.c i2c_master_noint.c -o i2c_speed_check
+//   ./i2c_speed_check
+
+#include <stdio.h>
+#include <xc.h>
+#include "i2c_master_noint.h"
+
+volatile I2CCON_BITS I2C2CONbits;
+volatile I2CSTAT_BITS I2C2STATbits;
+volatile unsigned I2C2BRG, I2C2TRN, I2C2RCV;
+volatile unsigned ANSELBCLR;
+
+#define REFUSED 0xFFFF              // BRG left as it was (no real BRG is this big)
+
+static const struct {
+    unsigned long hz;               // asked for
+    unsigned long rate;             // reported, 0: refused
+    unsigned brg;                   // written, REFUSED: not touched
+} cases[] = {
+    {100000, 100003, 233},          // standard mode
+    {400000, 400053, 53},           // fast mode, I2C_SPEED
+    {1000000, 1000333, 17},         // Fast-mode Plus
+    {12000, 12000, 1993},           // slow, still fits the 12 bits
+    {5000, 0, REFUSED},             // BRG 4793, more than 12 bits
+    {1000001, 0, REFUSED},          // faster than Fast-mode Plus
+    {0, 0, REFUSED},
+};
+
+int main(void) {
+    unsigned long rate;
+    unsigned i;
+    int failed = 0;
+
+    rate = i2c_master_setup();
+    printf("setup: %lu Hz, brg %u, on %u\n", rate, I2C2BRG, I2C2CONbits.ON);
+    if (rate != 400053 || I2C2BRG != 53 || !I2C2CONbits.ON) {
+        printf("  FAILED: expected 400053 Hz, brg 53, on 1\n");
+        failed = 1;
+    }
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        I2C2BRG = REFUSED;
+        rate = i2c_master_speed(cases[i].hz);
+        printf("%7lu Hz -> %7lu Hz, brg %4u, on %u\n", cases[i].hz, rate, I2C2BRG, I2C2CONbits.ON);
+        if (rate != cases[i].rate || I2C2BRG != cases[i].brg || !I2C2CONbits.ON) {
+            printf("  FAILED: expected %lu Hz, brg %u, on 1\n", cases[i].rate, cases[i].brg);
+            failed = 1;
+        }
+    }
+    printf(failed ? "FAILED\n" : "ok\n");
+    return failed;
+}
@@ -0,0 +1,20 @@
+#ifndef XC_H__
+#define XC_H__
+// Host stand-in for the compiler's xc.h, for the checks in this directory:
+// plain variables in place of the registers i2c_master_noint.c touches, so a
+// check can call a driver and then look at what it wrote
+
+typedef struct {
+    unsigned ON, SEN, RSEN, RCEN, ACKDT, ACKEN, PEN;
+} I2CCON_BITS;
+
+typedef struct {
+    unsigned TRSTAT, ACKSTAT, RBF;
+} I2CSTAT_BITS;
+
+extern volatile I2CCON_BITS I2C2CONbits;
+extern volatile I2CSTAT_BITS I2C2STATbits;
+extern volatile unsigned I2C2BRG, I2C2TRN, I2C2RCV;
+extern volatile unsigned ANSELBCLR;
+
+#endif
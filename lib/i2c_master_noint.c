@@ -0,0 +1,82 @@
+#include <xc.h>
+#include "i2c_master_noint.h"
+#include "pins.h"
+
+#define I2C(reg) PERIPH(I2C, I2C_BUS, reg) // a register of the I2C module in use
+
+// I2C Master utilities, 400 kHz by default, using polling rather than interrupts
+// The functions must be callled in the correct order as per the I2C protocol
+// I2C pins need pull-up resistors, 2k-10k
+// I2CxBRG = [1/(2*Fsck) - PGD]*PBCLK - 2, with PGD = 104 ns, so at a 48 MHz
+// PBCLK: 233 for 100 kHz, 53 for 400 kHz, 17 for 1 MHz (Fast-mode Plus, which
+// the part supports but not every slave does; the LSM6DS33 stops at 400 kHz)
+
+#define PGD_NS 104            // pulse gobbler delay
+#define MIN_BRG 2             // 0 and 1 aren't allowed
+#define MAX_BRG 0xFFF         // I2CxBRG is 12 bits
+#define MAX_SPEED 1000000     // Fast-mode Plus
+
+unsigned long i2c_master_setup(void) {
+  // turn off analog on the I2C pins
+  PIN_DIGITAL(I2C_SDA_PORT, I2C_SDA_BIT);
+  PIN_DIGITAL(I2C_SCL_PORT, I2C_SCL_BIT);
+
+  return i2c_master_speed(I2C_SPEED); // set the baud rate and turn on the I2C module
+}
+
+unsigned long i2c_master_speed(unsigned long hz) {
+  long long brg;
+
+  if (hz == 0 || hz > MAX_SPEED) {
+    return 0;
+  }
+  // PBCLK * (1/(2*hz) - PGD) - 2, rounded, in integers
+  brg = ((long long) LIB_PBCLK * (500000000LL - (long long) PGD_NS * hz) + 500000000LL * hz)
+        / (1000000000LL * hz) - 2;
+  if (brg < MIN_BRG || brg > MAX_BRG) {
+    return 0;
+  }
+  I2C(CONbits).ON = 0;        // the baud rate can't change while the module is on
+  I2C(BRG) = (unsigned int) brg;
+  I2C(CONbits).ON = 1;
+  // the rate that gives: 1 / (2 * ((BRG + 2)/PBCLK + PGD))
+  return (unsigned long) (1000000000LL * LIB_PBCLK
+        / (2 * ((brg + 2) * 1000000000LL + (long long) PGD_NS * LIB_PBCLK)));
+}
+
+// Start a transmission on the I2C bus
+void i2c_master_start(void) {
+    I2C(CONbits).SEN = 1;            // send the start bit
+    while(I2C(CONbits).SEN) {;}      // wait for the start bit to be sent
+}
+
+void i2c_master_restart(void) {
+    I2C(CONbits).RSEN = 1;            // send a restart
+    while(I2C(CONbits).RSEN) {;}      // wait for the restart to clear
+}
+
+void i2c_master_send(unsigned char byte) { // send a byte to slave
+  I2C(TRN) = byte;                     // if an address, bit 0 = 0 for write, 1 for read
+  while(I2C(STATbits).TRSTAT) {;}      // wait for the transmission to finish
+  if(I2C(STATbits).ACKSTAT) {          // if this is high, slave has not acknowledged
+    ;// ("I2C2 Master: failed to receive ACK\r\n");
+  }
+}
+
+unsigned char i2c_master_recv(void) { // receive a byte from the slave
+    I2C(CONbits).RCEN = 1;            // start receiving data
+    while(!I2C(STATbits).RBF) {;}     // wait to receive the data
+    return I2C(RCV);                  // read and return the data
+}
+
+void i2c_master_ack(int val) {        // sends ACK = 0 (slave should send another byte)
+                                      // or NACK = 1 (no more bytes requested from slave)
+    I2C(CONbits).ACKDT = val;         // store ACK/NACK in ACKDT
+    I2C(CONbits).ACKEN = 1;           // send ACKDT
+    while(I2C(CONbits).ACKEN) {;}     // wait for ACK/NACK to be sent
+}
+
+void i2c_master_stop(void) {          // send a STOP:
+  I2C(CONbits).PEN = 1;               // comm is complete and master relinquishes bus
+  while(I2C(CONbits).PEN) {;}         // wait for STOP to complete
+}
\ No newline at end of file
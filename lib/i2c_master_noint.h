@@ -3,7 +3,12 @@
 // Header file for i2c_master_noint.c
 // helps implement use I2C1 as a master without using interrupts
 
-void i2c_master_setup(void);              // set up I2C2 as master, at 400 kHz
+#include "lib_config.h"
+
+unsigned long i2c_master_setup(void);     // set up I2C_BUS (I2C2) as master, at I2C_SPEED,
+                                          // returns the actual rate
+unsigned long i2c_master_speed(unsigned long hz); // change the SCL rate, between transactions
+                                          // only, returns the rate set (0: can't, unchanged)
 
 void i2c_master_start(void);              // send a START signal
 void i2c_master_restart(void);            // send a RESTART signal
@@ -0,0 +1,66 @@
+#ifndef LIB_CONFIG_H__
+#define LIB_CONFIG_H__
+// Compile-time configuration of the drivers in lib/, shared by every app.
+// Each setting only has a default here: an app that needs another value
+// defines it in its project's preprocessor macros (e.g. LSM6DS33_SA0=0),
+// so the drivers themselves never differ from one app to the next.
+// Pins are a port letter and a bit, peripherals an instance number, both
+// turned into register names by pins.h. Settings under one #ifndef go
+// together: override all of them or none.
+
+#ifndef LIB_SYSCLK
+#define LIB_SYSCLK 48000000     // system clock, Hz (the core timer runs at half of it)
+#endif
+#ifndef LIB_PBCLK
+#define LIB_PBCLK 48000000      // peripheral bus clock, Hz (SYSCLK / FPBDIV)
+#endif
+
+// ST7735 LCD (ST7735.c)
+#ifndef LCD_SPI
+#define LCD_SPI 1               // SPIx
+#define LCD_SDI_INPUT 0b0100    // SDIxR: B8 (read, though nothing is connected)
+#define LCD_SDO_OUTPUT RPA1R    // the pin's PPS register: A1
+#define LCD_SDO_FUNCTION 0b0011 // SDO1
+#endif
+#ifndef LCD_CS_PORT
+#define LCD_CS_PORT B
+#define LCD_CS_BIT 7
+#endif
+#ifndef LCD_A0_PORT
+#define LCD_A0_PORT B           // A0: low for a command, high for data
+#define LCD_A0_BIT 15
+#endif
+#ifndef LCD_SPI_BRG
+#define LCD_SPI_BRG 0           // SPI clock = PBCLK / (2 * (LCD_SPI_BRG + 1)), 12 MHz
+#endif
+#ifndef LCD_HEIGHT
+#define LCD_HEIGHT 160          // rows of the panel, 128 for the 128x128 ones
+#endif
+#define LCD_GREEN_TAB 1         // the panel, by the color of the tab on its protective film
+#define LCD_RED_TAB 2
+#define LCD_BLACK_TAB 3
+#ifndef LCD_PANEL
+#define LCD_PANEL LCD_BLACK_TAB
+#endif
+#ifndef LCD_MADCTL
+#define LCD_MADCTL (MADCTL_MX | MADCTL_MY) // orientation: MX and MY mirror it, both turn it 180 degrees
+#endif
+
+// I2C master (i2c_master_noint.c)
+#ifndef I2C_BUS
+#define I2C_BUS 2               // I2Cx
+#define I2C_SDA_PORT B          // its pins, made digital
+#define I2C_SDA_BIT 2
+#define I2C_SCL_PORT B
+#define I2C_SCL_BIT 3
+#endif
+#ifndef I2C_SPEED
+#define I2C_SPEED 400000        // SCL Hz after i2c_master_setup(), up to 1 MHz
+#endif
+
+// LSM6DS33 IMU (lsm6ds33.c)
+#ifndef LSM6DS33_SA0
+#define LSM6DS33_SA0 1          // level of the SA0 pin, the low bit of the I2C address
+#endif
+
+#endif
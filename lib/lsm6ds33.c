@@ -0,0 +1,137 @@
+#include "lsm6ds33.h"
+#include "i2c_master_noint.h"
+
+// LSM6DS33 driver
+// The cache covers FIFO_CTRL1 to CTRL10_C. wanted[] is what the app has set,
+// chip[] what was last written, and a register counts as dirty while they
+// differ or the chip's value isn't known (after lsm6ds33_setup()).
+// A flush walks the map and writes each run of dirty registers as one
+// burst (start, address, register, bytes..., stop), relying on IF_INC.
+// Clean registers between two dirty ones are written along if that is
+// shorter than a new transaction, but a burst never crosses a register that
+// can't be written. CTRL3_C goes first and on its own when it is dirty,
+// since it holds IF_INC.
+
+#define FIRST LSM6DS33_FIFO_CTRL1
+#define LAST LSM6DS33_CTRL10_C
+#define COUNT (LAST - FIRST + 1)
+#define MAX_GAP 2                   // clean registers a burst carries rather than split
+
+// power-on values, 0 for the registers that can't be written
+static const unsigned char reset[COUNT] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // FIFO_CTRL1..5, ORIENT_CFG_G
+    0x00, 0x00, 0x00, 0x00,                 // reserved, INT1_CTRL, INT2_CTRL, WHO_AM_I
+    0x00, 0x00, 0x04, 0x00, 0x00,           // CTRL1_XL, CTRL2_G, CTRL3_C, CTRL4_C, CTRL5_C
+    0x00, 0x00, 0x00, 0x38, 0x38            // CTRL6_C, CTRL7_G, CTRL8_XL, CTRL9_XL, CTRL10_C
+};
+
+static unsigned char wanted[COUNT];
+static unsigned char chip[COUNT];
+static unsigned char known[COUNT];
+
+static int writable(int reg) {
+    return reg >= FIRST && reg <= LAST && reg != 0x0C && reg != LSM6DS33_WHO_AM_I;
+}
+
+static int dirty(int reg) {
+    return writable(reg) && (!known[reg - FIRST] || wanted[reg - FIRST] != chip[reg - FIRST]);
+}
+
+void lsm6ds33_setup(void) {
+    int k;
+    for (k = 0; k < COUNT; k++) {
+        wanted[k] = reset[k];
+        known[k] = 0;
+    }
+}
+
+unsigned char lsm6ds33_get(unsigned char reg) {
+    return writable(reg) ? wanted[reg - FIRST] : 0;
+}
+
+void lsm6ds33_set(unsigned char reg, unsigned char value) {
+    if (!writable(reg)) {
+        return;
+    }
+    if (reg == LSM6DS33_CTRL3_C) {
+        value |= LSM6DS33_IF_INC;
+    }
+    wanted[reg - FIRST] = value;
+}
+
+void lsm6ds33_set_bits(unsigned char reg, unsigned char mask, unsigned char value) {
+    lsm6ds33_set(reg, (lsm6ds33_get(reg) & ~mask) | (value & mask));
+}
+
+void lsm6ds33_accel(LSM6DS33_ODR odr, LSM6DS33_XL_FS fs, LSM6DS33_XL_BW bw) {
+    lsm6ds33_set(LSM6DS33_CTRL1_XL, (odr << 4) | (fs << 2) | bw);
+}
+
+void lsm6ds33_gyro(LSM6DS33_ODR odr, LSM6DS33_G_FS fs) {
+    lsm6ds33_set(LSM6DS33_CTRL2_G, (odr << 4) | (fs << 2));
+}
+
+// write registers first..last in one transaction
+static void burst(int first, int last) {
+    int reg;
+    i2c_master_start();
+    i2c_master_send(LSM6DS33_ADDRESS << 1);
+    i2c_master_send(first);
+    for (reg = first; reg <= last; reg++) {
+        i2c_master_send(wanted[reg - FIRST]);
+        chip[reg - FIRST] = wanted[reg - FIRST];
+        known[reg - FIRST] = 1;
+    }
+    i2c_master_stop();
+}
+
+int lsm6ds33_flush(void) {
+    int reg, n = 0;
+
+    if (dirty(LSM6DS33_CTRL3_C)) {
+        burst(LSM6DS33_CTRL3_C, LSM6DS33_CTRL3_C);
+        n++;
+    }
+    for (reg = FIRST; reg <= LAST; reg++) {
+        int end, next;
+        if (!dirty(reg)) {
+            continue;
+        }
+        // extend the run to the last dirty register reachable over short clean gaps
+        end = reg;
+        for (next = reg + 1; next <= LAST && writable(next) && next - end <= MAX_GAP + 1; next++) {
+            if (dirty(next)) {
+                end = next;
+            }
+        }
+        burst(reg, end);
+        n++;
+        reg = end;
+    }
+    return n;
+}
+
+void lsm6ds33_write(unsigned char reg, unsigned char value) {
+    lsm6ds33_set(reg, value);
+    lsm6ds33_flush();
+}
+
+void lsm6ds33_read(unsigned char reg, unsigned char *data, int length) {
+    int i;
+    i2c_master_start();
+    i2c_master_send(LSM6DS33_ADDRESS << 1);         // write the register address
+    i2c_master_send(reg);
+    i2c_master_restart();
+    i2c_master_send((LSM6DS33_ADDRESS << 1) | 1);   // then read from it on
+    for (i = 0; i < length; i++) {
+        data[i] = i2c_master_recv();
+        i2c_master_ack(i < length - 1 ? 0 : 1);     // NACK the last byte
+    }
+    i2c_master_stop();
+}
+
+unsigned char lsm6ds33_who_am_i(void) {
+    unsigned char id;
+    lsm6ds33_read(LSM6DS33_WHO_AM_I, &id, 1);
+    return id;
+}
@@ -0,0 +1,90 @@
+#ifndef LSM6DS33_H__
+#define LSM6DS33_H__
+// Header file for lsm6ds33.c
+// LSM6DS33 register map over I2C (i2c_master_noint): the control registers
+// are cached, setters only change the cache, and lsm6ds33_flush() writes the
+// registers that differ from the chip in as few bursts as it can, so the
+// configuration can change at run time without a re-init
+
+#include "lib_config.h"
+
+#define LSM6DS33_ADDRESS (0b1101010 | LSM6DS33_SA0)
+
+// registers
+#define LSM6DS33_FIFO_CTRL1   0x06  // FIFO threshold, low byte
+#define LSM6DS33_FIFO_CTRL2   0x07  // FIFO threshold, high bits
+#define LSM6DS33_FIFO_CTRL3   0x08  // gyro and accelerometer decimation into the FIFO
+#define LSM6DS33_FIFO_CTRL4   0x09
+#define LSM6DS33_FIFO_CTRL5   0x0A  // FIFO ODR and mode
+#define LSM6DS33_ORIENT_CFG_G 0x0B
+#define LSM6DS33_INT1_CTRL    0x0D  // INT1 sources
+#define LSM6DS33_INT2_CTRL    0x0E
+#define LSM6DS33_WHO_AM_I     0x0F  // reads 0x69
+#define LSM6DS33_CTRL1_XL     0x10  // accelerometer ODR, full scale, bandwidth
+#define LSM6DS33_CTRL2_G      0x11  // gyro ODR, full scale
+#define LSM6DS33_CTRL3_C      0x12  // IF_INC, BDU, reset
+#define LSM6DS33_CTRL4_C      0x13
+#define LSM6DS33_CTRL5_C      0x14
+#define LSM6DS33_CTRL6_C      0x15
+#define LSM6DS33_CTRL7_G      0x16
+#define LSM6DS33_CTRL8_XL     0x17
+#define LSM6DS33_CTRL9_XL     0x18  // accelerometer axis enables
+#define LSM6DS33_CTRL10_C     0x19  // gyro axis enables
+#define LSM6DS33_OUT_TEMP_L   0x20  // temperature, then gyro x,y,z, then accelerometer x,y,z
+#define LSM6DS33_OUTX_L_G     0x22
+#define LSM6DS33_OUTX_L_XL    0x28
+
+#define LSM6DS33_WHO_AM_I_VALUE 0x69
+#define LSM6DS33_IF_INC 0x04        // CTRL3_C: address auto-increment, always kept on
+
+// output data rates, for both sensors
+typedef enum {
+    LSM6DS33_ODR_OFF = 0,
+    LSM6DS33_ODR_13HZ,
+    LSM6DS33_ODR_26HZ,
+    LSM6DS33_ODR_52HZ,
+    LSM6DS33_ODR_104HZ,
+    LSM6DS33_ODR_208HZ,
+    LSM6DS33_ODR_416HZ,
+    LSM6DS33_ODR_833HZ,
+    LSM6DS33_ODR_1660HZ,
+    LSM6DS33_ODR_3330HZ,    // accelerometer only
+    LSM6DS33_ODR_6660HZ     // accelerometer only
+} LSM6DS33_ODR;
+
+// accelerometer full scale, in the order of the FS_XL bits
+typedef enum {
+    LSM6DS33_XL_2G = 0,
+    LSM6DS33_XL_16G,
+    LSM6DS33_XL_4G,
+    LSM6DS33_XL_8G
+} LSM6DS33_XL_FS;
+
+// accelerometer anti-aliasing filter
+typedef enum {
+    LSM6DS33_XL_BW_400HZ = 0,
+    LSM6DS33_XL_BW_200HZ,
+    LSM6DS33_XL_BW_100HZ,
+    LSM6DS33_XL_BW_50HZ
+} LSM6DS33_XL_BW;
+
+// gyro full scale, in the order of the FS_G bits
+typedef enum {
+    LSM6DS33_G_245DPS = 0,
+    LSM6DS33_G_500DPS,
+    LSM6DS33_G_1000DPS,
+    LSM6DS33_G_2000DPS
+} LSM6DS33_G_FS;
+
+void lsm6ds33_setup(void);              // cache the power-on values, all written by the next flush
+unsigned char lsm6ds33_get(unsigned char reg); // cached value of a control register
+void lsm6ds33_set(unsigned char reg, unsigned char value); // change the cache only
+void lsm6ds33_set_bits(unsigned char reg, unsigned char mask, unsigned char value);
+void lsm6ds33_accel(LSM6DS33_ODR odr, LSM6DS33_XL_FS fs, LSM6DS33_XL_BW bw); // set CTRL1_XL
+void lsm6ds33_gyro(LSM6DS33_ODR odr, LSM6DS33_G_FS fs); // set CTRL2_G
+int lsm6ds33_flush(void);               // write what changed, returns the I2C transactions used
+void lsm6ds33_write(unsigned char reg, unsigned char value); // set and flush
+void lsm6ds33_read(unsigned char reg, unsigned char *data, int length); // burst read
+unsigned char lsm6ds33_who_am_i(void);
+
+#endif
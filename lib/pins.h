@@ -0,0 +1,25 @@
+#ifndef PINS_H__
+#define PINS_H__
+// Pin and peripheral accessors for the drivers in lib/, bound at compile time
+// from the port letter, bit number and instance number in lib_config.h.
+// Each pin macro is a single write of one bit to the port's SET, CLR or INV
+// register, so it can't disturb the other pins of the port the way a
+// read-modify-write of LATxbits can (and costs no more).
+
+#include <xc.h>
+
+#define PINS_CAT_(a, b, c) a##b##c
+#define PINS_CAT(a, b, c) PINS_CAT_(a, b, c)    // expands its arguments first
+
+#define PIN_HIGH(port, bit)    (PINS_CAT(LAT, port, SET) = 1u << (bit))
+#define PIN_LOW(port, bit)     (PINS_CAT(LAT, port, CLR) = 1u << (bit))
+#define PIN_TOGGLE(port, bit)  (PINS_CAT(LAT, port, INV) = 1u << (bit))
+#define PIN_READ(port, bit)    ((PINS_CAT(PORT, port, ) >> (bit)) & 1)
+#define PIN_OUTPUT(port, bit)  (PINS_CAT(TRIS, port, CLR) = 1u << (bit))
+#define PIN_INPUT(port, bit)   (PINS_CAT(TRIS, port, SET) = 1u << (bit))
+#define PIN_DIGITAL(port, bit) (PINS_CAT(ANSEL, port, CLR) = 1u << (bit))
+
+// a register of peripheral instance n, e.g. PERIPH(SPI, 1, BUF) is SPI1BUF
+#define PERIPH(name, n, reg) PINS_CAT(name, n, reg)
+
+#endif
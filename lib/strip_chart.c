@@ -0,0 +1,136 @@
+#include "strip_chart.h"
+
+// Strip chart
+// The chart is the LCD's scrolling area (LCD_scrollArea): the newest line is
+// drawn over the oldest one and the area scrolled by a row so that it shows
+// at the bottom, with the rest moved up. Values run across the columns, and
+// a trace that moved since its last sample is drawn as a span from the old
+// column to the new one, so fast changes stay joined up.
+// Automatic scaling widens the range as soon as a value falls outside it,
+// with a margin of an eighth on the side that grew, and narrows it to what
+// was seen (plus the margin) once a whole chart of samples has used less
+// than half of it. Lines already drawn keep their scale, so a change of
+// scale is marked by a line in the axis color.
+
+#define BACKGROUND BLACK
+#define AXIS 0x4208                 // dark grey: zero, and changes of scale
+
+static unsigned short top, height;  // the area
+static unsigned short row;          // of the newest line, in the area
+static int count;                   // traces
+static unsigned short color[STRIP_CHART_TRACES];
+static short last[STRIP_CHART_TRACES]; // column of each trace's last sample, -1: none
+static long lo, hi;                 // the values at the first and last column
+static int automatic;
+static long seenLo, seenHi;         // range of the values since the last check
+static int seen;                    // samples since then
+static unsigned short line[_GRAMWIDTH];
+
+void strip_chart_setup(unsigned short y, unsigned short h, int traces, const unsigned short *colors) {
+    int i;
+
+    top = y;
+    height = h;
+    row = h - 1;
+    count = traces < 1 ? 1 : (traces > STRIP_CHART_TRACES ? STRIP_CHART_TRACES : traces);
+    for (i = 0; i < count; i++) {
+        color[i] = colors[i];
+        last[i] = -1;
+    }
+    strip_chart_scale(0, 0);
+
+    for (i = 0; i < _GRAMWIDTH; i++) {
+        line[i] = BACKGROUND;
+    }
+    for (i = 0; i < h; i++) {
+        LCD_setAddr(0, y + i, _GRAMWIDTH - 1, y + i);
+        LCD_pixels(line, _GRAMWIDTH);
+    }
+    LCD_scrollArea(y, h);
+}
+
+void strip_chart_scale(long l, long h) {
+    automatic = l == h;
+    lo = automatic ? 0 : l;         // lo == hi until the first sample
+    hi = automatic ? 0 : h;
+    seen = 0;
+}
+
+// lo and hi around l to h, with the margin
+static void fit(long l, long h) {
+    long margin = (h - l) / 8 + 1;
+    lo = l - margin;
+    hi = h + margin;
+}
+
+// adjusts the range to a sample, returns 1 if it changed
+static int rescale(const long *values) {
+    long vlo = values[0], vhi = values[0], margin;
+    int i;
+
+    for (i = 1; i < count; i++) {
+        vlo = values[i] < vlo ? values[i] : vlo;
+        vhi = values[i] > vhi ? values[i] : vhi;
+    }
+    if (seen == 0 || vlo < seenLo) {
+        seenLo = vlo;
+    }
+    if (seen == 0 || vhi > seenHi) {
+        seenHi = vhi;
+    }
+    seen++;
+
+    if (lo == hi) {
+        fit(vlo, vhi);
+        return 1;
+    }
+    if (vlo < lo || vhi > hi) {
+        margin = ((vhi > hi ? vhi : hi) - (vlo < lo ? vlo : lo)) / 8 + 1;
+        if (vlo < lo) {
+            lo = vlo - margin;
+        }
+        if (vhi > hi) {
+            hi = vhi + margin;
+        }
+        return 1;
+    }
+    if (seen < height) {
+        return 0;
+    }
+    seen = 0;
+    if (seenHi - seenLo >= (hi - lo) / 2) {
+        return 0;
+    }
+    fit(seenLo, seenHi);
+    return 1;
+}
+
+static int column(long value) {
+    long long c = (long long) (value - lo) * (_GRAMWIDTH - 1) / (hi - lo);
+    return c < 0 ? 0 : (c > _GRAMWIDTH - 1 ? _GRAMWIDTH - 1 : (int) c);
+}
+
+void strip_chart_add(const long *values) {
+    int i, x, from, to, changed = automatic && rescale(values);
+    unsigned short y;
+
+    for (x = 0; x < _GRAMWIDTH; x++) {
+        line[x] = changed ? AXIS : BACKGROUND;
+    }
+    if (!changed && lo <= 0 && hi >= 0) {
+        line[column(0)] = AXIS;
+    }
+    for (i = 0; i < count; i++) {
+        to = column(values[i]);
+        from = last[i] < 0 || changed ? to : last[i]; // the old column is on the old scale
+        last[i] = to;
+        for (x = from < to ? from : to; x <= (from < to ? to : from); x++) {
+            line[x] = color[i];
+        }
+    }
+    row = row + 1 == height ? 0 : row + 1;
+    y = top + row;
+    LCD_setAddr(0, y, _GRAMWIDTH - 1, y);
+    LCD_pixels(line, _GRAMWIDTH);
+    LCD_scroll(row + 1);            // the new line last
+}
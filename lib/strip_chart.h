@@ -0,0 +1,18 @@
+#ifndef STRIP_CHART_H__
+#define STRIP_CHART_H__
+// Header file for strip_chart.c
+// a scrolling plot of a few traces on the ST7735: each sample is one line
+// across the chart, drawn at the end, while the LCD scrolls the older ones
+// along in hardware, so a sample costs one line of pixels over SPI
+
+#include "ST7735.h"
+
+#define STRIP_CHART_TRACES 4
+
+void strip_chart_setup(unsigned short y, unsigned short h, int traces, const unsigned short *colors);
+                                    // rows y to y+h-1, once the LCD is up: clears them and
+                                    // scales automatically
+void strip_chart_scale(long lo, long hi); // fixed value range across the chart, lo == hi: automatic
+void strip_chart_add(const long *values); // one sample of every trace, as one new line
+
+#endif